@@ -24,9 +24,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <gtkmm-plplot/exception.h>
 #include <gtkmm-plplot/legend.h>
 #include <gtkmm-plplot/regionselection.h>
+#include <gtkmm-plplot/renderworker.h>
+#include <gtkmm-plplot/renderpool.h>
 #include <valarray>
 #include <cmath>
 #include <gdkmm/general.h>
+#include <gdkmm/frameclock.h>
 #include <iostream>
 #include <typeinfo>
 
@@ -51,9 +54,21 @@ Canvas::Canvas(Gdk::RGBA _background_color) :
   inside_plot(nullptr),
   inside_plot_current_coords{0.0, 0.0},
   mouse_current_coords{0.0, 0.0},
-  background_color(_background_color) {
+  background_color(_background_color),
+  freeze_count(0),
+  redraw_pending(false),
+  max_frame_rate(0.0),
+  last_redraw_time(0),
+  tick_callback_id(0),
+  plot_cache_valid(false),
+  render_generation(0),
+  render_width(0),
+  render_height(0),
+  render_scale_factor(0),
+  render_busy(false) {
   set_can_focus(true);
 
+  signal_changed().connect([this](){plot_cache_valid = false;});
   signal_changed().connect(sigc::mem_fun(*this, &Canvas::on_changed));
 
   set_draw_func(sigc::mem_fun(*this, &Canvas::on_draw));
@@ -122,6 +137,9 @@ void Canvas::add_plot(Plot &plot) {
 }
 
 Canvas::~Canvas() {
+  if (tick_callback_id != 0)
+    remove_tick_callback(tick_callback_id);
+
   for (auto &iter : plots) {
     if (iter->is_managed_()) {
       delete iter;
@@ -132,11 +150,229 @@ Canvas::~Canvas() {
 void Canvas::on_changed() {
   //this catches all signal_changed emissions recursively from the Plot and PlotData classes
   //so this is the method that ensures things get redrawn when one of the parameters is changed.
+  request_redraw();
+}
+
+void Canvas::request_redraw() {
+  redraw_pending = true;
+
+  //a tick callback is already waiting for the next permitted frame
+  if (freeze_count > 0 || tick_callback_id != 0)
+    return;
+
+  if (max_frame_rate <= 0.0 || !get_realized()) {
+    redraw_pending = false;
+    this->queue_draw();
+    return;
+  }
+
+  tick_callback_id = add_tick_callback(sigc::mem_fun(*this, &Canvas::on_frame_tick));
+}
+
+bool Canvas::on_frame_tick(const Glib::RefPtr<Gdk::FrameClock> &frame_clock) {
+  const gint64 frame_time = frame_clock->get_frame_time();
+
+  if (freeze_count == 0 && redraw_pending &&
+      frame_time - last_redraw_time >= static_cast<gint64>(1E6 / max_frame_rate)) {
+    redraw_pending = false;
+    last_redraw_time = frame_time;
+    this->queue_draw();
+  }
+
+  if (!redraw_pending || freeze_count > 0) {
+    tick_callback_id = 0;
+    return false;
+  }
+  return true;
+}
+
+void Canvas::freeze() {
+  freeze_count++;
+}
+
+void Canvas::thaw() {
+  if (freeze_count == 0)
+    throw Exception("Gtk::PLplot::Canvas::thaw -> canvas is not frozen");
+
+  if (--freeze_count == 0 && redraw_pending)
+    request_redraw();
+}
+
+void Canvas::set_async_rasterization(bool _async_rasterization) {
+  if (_async_rasterization == get_async_rasterization())
+    return;
+
+  if (_async_rasterization) {
+    if (get_parallel_rasterization())
+      throw Exception("Gtk::PLplot::Canvas::set_async_rasterization -> cannot be enabled together with parallel rasterization");
+    render_worker.reset(new RenderWorker());
+    render_worker->signal_finished().connect(sigc::mem_fun(*this, &Canvas::on_render_finished));
+  }
+  else {
+    render_worker.reset();
+    //frames that are still being rasterized will not be delivered anymore, and the plots they were rasterizing may be incomplete
+    render_generation++;
+    render_busy = false;
+    for (auto &iter : plots)
+      iter->invalidate_plot_cache();
+  }
+
+  plot_cache_valid = false;
+  this->queue_draw();
+}
+
+void Canvas::set_parallel_rasterization(bool _parallel_rasterization) {
+  if (_parallel_rasterization == get_parallel_rasterization())
+    return;
+
+  if (_parallel_rasterization) {
+    if (get_async_rasterization())
+      throw Exception("Gtk::PLplot::Canvas::set_parallel_rasterization -> cannot be enabled together with asynchronous rasterization");
+    render_pool.reset(new RenderPool());
+  }
+  else
+    render_pool.reset();
+}
+
+bool Canvas::get_parallel_rasterization() {
+  return static_cast<bool>(render_pool);
+}
+
+bool Canvas::get_async_rasterization() {
+  return static_cast<bool>(render_worker);
+}
+
+void Canvas::on_render_finished(unsigned long generation, Cairo::RefPtr<Cairo::ImageSurface> image) {
+  //drop frames that became outdated while they were being rasterized
+  if (generation != render_generation)
+    return;
+
+  render_busy = false;
+  plot_cache = image;
   this->queue_draw();
 }
 
+bool Canvas::is_frozen() {
+  return freeze_count > 0;
+}
+
+void Canvas::set_max_frame_rate(double _max_frame_rate) {
+  if (_max_frame_rate == max_frame_rate)
+    return;
+
+  if (_max_frame_rate < 0.0)
+    throw Exception("Gtk::PLplot::Canvas::set_max_frame_rate -> max_frame_rate cannot be negative");
+
+  max_frame_rate = _max_frame_rate;
+}
+
+double Canvas::get_max_frame_rate() {
+  return max_frame_rate;
+}
+
+void Canvas::invalidate_plot_cache() {
+  plot_cache_valid = false;
+  this->queue_draw();
+}
+
+void Canvas::update_plot_cache(int width, int height) {
+  const int scale_factor = get_scale_factor();
+
+  if (render_worker) {
+    //the worker owns the plot caches until it delivers its frame: changes made in the meantime are picked up afterwards
+    if (render_busy)
+      return;
+    if (plot_cache_valid && render_width == width && render_height == height && render_scale_factor == scale_factor)
+      return;
+
+    //PLplot is not thread-safe: the plots that changed are recorded here, and rasterized onto their caches by the worker.
+    //The target only tells record_plot_cached() the device scale of the frame.
+    auto target = Cairo::RecordingSurface::create();
+    target->set_device_scale(scale_factor, scale_factor);
+    auto target_cr = Cairo::Context::create(target);
+    std::vector<RenderWorker::Layer> layers;
+    for (auto &iter : plots) {
+      auto recording = iter->record_plot_cached(target_cr, width, height);
+      if (!iter->is_showing() || !iter->plot_cache)
+        continue;
+      if (recording)
+        iter->plot_cache_valid = true;
+      layers.push_back({iter->plot_cache, recording,
+                        static_cast<int>(width * iter->plot_offset_horizontal_norm),
+                        static_cast<int>(height * iter->plot_offset_vertical_norm)});
+    }
+
+    render_worker->submit(++render_generation, layers, background_color, width, height, scale_factor);
+    render_busy = true;
+    render_width = width;
+    render_height = height;
+    render_scale_factor = scale_factor;
+    plot_cache_valid = true;
+    return;
+  }
+
+  if (plot_cache_valid && plot_cache &&
+      plot_cache->get_width() == width * scale_factor &&
+      plot_cache->get_height() == height * scale_factor)
+    return;
+
+  if (!plot_cache ||
+      plot_cache->get_width() != width * scale_factor ||
+      plot_cache->get_height() != height * scale_factor) {
+    plot_cache = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, width * scale_factor, height * scale_factor);
+    plot_cache->set_device_scale(scale_factor, scale_factor);
+  }
+
+  //only the plots that changed since the previous redraw are rendered again
+  auto cache_cr = Cairo::Context::create(plot_cache);
+
+  if (render_pool) {
+    //PLplot is not thread-safe: the plots are recorded here, and rasterized by the pool
+    std::vector<std::function<void()>> jobs;
+    for (auto &iter : plots) {
+      auto recording = iter->record_plot_cached(cache_cr, width, height);
+      if (recording) {
+        Plot *plot = iter;
+        jobs.push_back([plot, recording](){plot->rasterize_plot_cache(recording);});
+      }
+    }
+    //with a single plot to rasterize, there is nothing to gain from the pool
+    if (jobs.size() == 1)
+      jobs.front()();
+    else
+      render_pool->run_jobs(jobs);
+  }
+
+  cache_cr->rectangle(0.0, 0.0, width, height);
+  Gdk::Cairo::set_source_rgba(cache_cr, background_color);
+  cache_cr->fill();
+  for (auto &iter : plots) {
+    iter->draw_plot_cached(cache_cr, width, height);
+  }
+  plot_cache->flush();
+  plot_cache_valid = true;
+}
+
 void Canvas::on_draw(const Cairo::RefPtr<Cairo::Context> &cr, int width, int height) {
-  draw_plot(cr, width, height);
+  if (width <= 0 || height <= 0)
+    return;
+
+  //the plots are only rendered again if they changed since the previous redraw.
+  //While frozen, redraws requested by GTK show the previous frame, to avoid revealing a partially applied batch of changes.
+  if (freeze_count == 0)
+    update_plot_cache(width, height);
+  else
+    redraw_pending = true;
+  cr->save();
+  if (plot_cache) {
+    cr->set_source(plot_cache, 0.0, 0.0);
+  }
+  else {
+    //the first frame is still being rendered in the background
+    Gdk::Cairo::set_source_rgba(cr, background_color);
+  }
+  cr->paint();
+  cr->restore();
 
   if (selecting &&
     start_cairo[0] >= 0.0 &&
@@ -310,7 +546,7 @@ void Canvas::on_button_release_event(int n_press, double x, double y) {
   end_plplot_def[1] = MAX(start_plplot[1], end_plplot[1]);
 
   //this is necessary to get rid of the box on the plot, even if the signal_select_region is not caught by the plot
-  _signal_changed.emit();
+  this->queue_draw();
 
   double start_world[2];
   double end_world[2];
@@ -447,7 +683,8 @@ void Canvas::on_motion_notify_event (double x, double y) {
     end_cairo[1] = MAX(end_cairo[1], region_selection->cairo_range_y[0]);
   }
 
-  _signal_changed.emit();
+  //only the selection box changed: the cached plots can be reused
+  this->queue_draw();
 }
 
 bool Canvas::on_key_press_event(guint keyval, guint keycode, Gdk::ModifierType state) {
@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <gtkmm/drawingarea.h>
 #include <gtkmm-plplot/plot.h>
 #include <vector>
+#include <memory>
 #include <gdkmm/rgba.h>
 
 
@@ -38,6 +39,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 namespace Gtk {
   namespace PLplot {
+    class RenderWorker;
+    class RenderPool;
 
     /** \class Canvas canvas.h <gtkmm-plplot/canvas.h>
      *  \brief Principal plotting widget
@@ -66,6 +69,20 @@ namespace Gtk {
       double inside_plot_current_coords[2]; ///< coords of the current cursor position within inside_plot, updated in on_motion_notify_event();
       double mouse_current_coords[2]; ///< coords of the current cursor position;
       Gdk::RGBA background_color; ///< the currently used background color of the canvas (default = opaque White)
+      unsigned int freeze_count; ///< the number of times freeze() has been called without a matching thaw()
+      bool redraw_pending; ///< set to true if a redraw was requested while the canvas was frozen or while waiting for the next permitted frame
+      double max_frame_rate; ///< the maximum number of redraws per second, or 0 if unlimited
+      gint64 last_redraw_time; ///< the frame clock time in microseconds at which the last redraw was queued
+      guint tick_callback_id; ///< the id of the tick callback that is waiting for the next permitted frame, or 0 if none
+      Cairo::RefPtr<Cairo::ImageSurface> plot_cache; ///< the background and plots, as rendered by the last call to on_draw()
+      bool plot_cache_valid; ///< set to false whenever signal_changed() is emitted, forcing the plots to be rendered again. In asynchronous rasterization mode, set to true as soon as a frame has been submitted to \c render_worker
+      std::unique_ptr<RenderWorker> render_worker; ///< the worker that rasterizes the plots in asynchronous rasterization mode, or nullptr if this mode is disabled
+      unsigned long render_generation; ///< the generation of the frame that was most recently submitted to \c render_worker
+      int render_width; ///< the width of the frame that was most recently submitted to \c render_worker
+      int render_height; ///< the height of the frame that was most recently submitted to \c render_worker
+      int render_scale_factor; ///< the scale factor of the frame that was most recently submitted to \c render_worker
+      bool render_busy; ///< set to true while \c render_worker is rasterizing a frame, during which the plot caches must not be touched
+      std::unique_ptr<RenderPool> render_pool; ///< the threads that rasterize the plots in parallel rasterization mode, or nullptr if this mode is disabled
       Canvas(const Canvas &) = delete; ///< no copy constructor
       Canvas &operator=(const Canvas &) = delete; ///< no move assignment operator
             
@@ -78,9 +95,38 @@ namespace Gtk {
        * \return \c true if the key press was handled, \c false otherwise.
        */
       bool handle_motion_event(double x, double y);
+
+      /** Ask for a redraw of the canvas, taking the frozen state and the maximum frame rate into account
+       *
+       */
+      void request_redraw();
+
+      /** Tick callback that queues the pending redraw once the minimum frame interval has elapsed
+       *
+       * \param frame_clock the frame clock of the widget
+       * \return \c true if the callback should continue to be called, \c false otherwise
+       */
+      bool on_frame_tick(const Glib::RefPtr<Gdk::FrameClock> &frame_clock);
+
+      /** Ensure that \c plot_cache contains the background and plots, rendering them again if necessary
+       *
+       * \param width The cairo draw width
+       * \param height The cairo draw height
+       */
+      void update_plot_cache(int width, int height);
+
+      /** Handler for RenderWorker::signal_finished()
+       *
+       * Replaces \c plot_cache with the rasterized frame, unless a more recent frame has been submitted in the meantime.
+       * \param generation the generation of the rasterized frame
+       * \param image the rasterized frame
+       */
+      void on_render_finished(unsigned long generation, Cairo::RefPtr<Cairo::ImageSurface> image);
     protected:
       /** This is a default handler for signal_draw().
        *
+       * The background and plots are rendered to an offscreen surface, which is reused for as long as signal_changed() is not emitted.
+       * The selection box and the focus box are drawn on top of this surface, so they can be updated without rendering the plots again.
        * When deriving from Canvas and if overriding this method, you may still want to call it to ensure proper drawing of the plots provided by Gtkmm-PLplot
        * \param cr The cairo context to draw to.
        * \param width The cairo draw width
@@ -158,6 +204,35 @@ namespace Gtk {
        */
       virtual void on_changed();
     public:
+      /** \class ScopedFreeze canvas.h <gtkmm-plplot/canvas.h>
+       *  \brief freezes a canvas for the lifetime of the instance
+       *
+       *  Calls Canvas::freeze() when constructed and Canvas::thaw() when destroyed,
+       *  ensuring that all changes made to the canvas, its plots and their datasets within a scope
+       *  result in a single redraw, even when an exception is thrown.
+       */
+      class ScopedFreeze {
+      private:
+        Canvas &canvas; ///< the frozen canvas
+        ScopedFreeze(const ScopedFreeze &) = delete; ///< no copy constructor
+        ScopedFreeze &operator=(const ScopedFreeze &) = delete; ///< no assignment operator
+      public:
+        /** Constructor
+         *
+         * \param canvas the canvas that will be frozen
+         */
+        explicit ScopedFreeze(Canvas &canvas) : canvas(canvas) {
+          canvas.freeze();
+        }
+
+        /** Destructor
+         *
+         */
+        ~ScopedFreeze() {
+          canvas.thaw();
+        }
+      };
+
       /** Canvas constructor
        *
        * This is the default class constructor, which will produce only a widget with the \c background_color specified.
@@ -220,6 +295,89 @@ namespace Gtk {
         return _signal_changed;
       }
 
+      /** Discard the offscreen rendering of the plots
+       *
+       * This will force the plots to be rendered again on the next redraw, which is then queued.
+       * It is only necessary to call this method when the appearance of the plots was changed without signal_changed() being emitted,
+       * for example by inheriting classes that render additional content.
+       */
+      void invalidate_plot_cache();
+
+      /** Enable or disable asynchronous rasterization
+       *
+       * In this mode, the plots that changed since the previous redraw are drawn onto separate Cairo recording surfaces on the main thread,
+       * which are then rasterized on a background thread and composited with the unchanged plots. Until the rasterized frame is available,
+       * the canvas will keep showing the previous frame, and changes made in the meantime are rendered in the next frame.
+       * Since PLplot is not thread-safe, all PLplot work, including the calculation of contours and shade fills, remains on the main thread:
+       * only the time spent by Cairo to fill and antialias the recorded paths is taken off the main thread.
+       * Asynchronous rasterization is disabled by default, and cannot be enabled together with parallel rasterization.
+       * \param async_rasterization \c true to enable asynchronous rasterization, \c false to disable it
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_async_rasterization(bool async_rasterization);
+
+      /** Check if asynchronous rasterization is enabled
+       *
+       * \return \c true if asynchronous rasterization is enabled, \c false otherwise
+       */
+      bool get_async_rasterization();
+
+      /** Enable or disable parallel rasterization
+       *
+       * In this mode, the plots that changed since the previous redraw are drawn onto separate Cairo recording surfaces
+       * on the main thread, after which these are rasterized concurrently on a pool of threads, and composited in the order they were added.
+       * Since PLplot is not thread-safe, all PLplot work still happens on the main thread, one plot after the other:
+       * only the time spent by Cairo to fill and antialias the recorded paths is divided over the threads.
+       * Parallel rasterization is disabled by default, and cannot be enabled together with asynchronous rasterization.
+       * \param parallel_rasterization \c true to enable parallel rasterization, \c false to disable it
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_parallel_rasterization(bool parallel_rasterization);
+
+      /** Check if parallel rasterization is enabled
+       *
+       * \return \c true if parallel rasterization is enabled, \c false otherwise
+       */
+      bool get_parallel_rasterization();
+
+      /** Stop redrawing the canvas in response to signal_changed()
+       *
+       * Use this method before making a large number of changes to the canvas, its plots and their datasets,
+       * to avoid intermediate redraws. signal_changed() will still be emitted. While frozen, redraws requested by GTK, for example after resizing,
+       * will keep showing the plots as they were rendered before the canvas was frozen.
+       * Calls may be nested: the canvas will be redrawn, if necessary, once the number of thaw() calls matches the number of freeze() calls.
+       * Consider using a ScopedFreeze instance instead, which will ensure thaw() gets called.
+       */
+      void freeze();
+
+      /** Resume redrawing the canvas in response to signal_changed()
+       *
+       * If any changes were made while the canvas was frozen, a single redraw will be queued.
+       * \exception Gtk::PLplot::Exception
+       */
+      void thaw();
+
+      /** Check if the canvas is currently frozen
+       *
+       * \return \c true if freeze() has been called more often than thaw(), \c false otherwise
+       */
+      bool is_frozen();
+
+      /** Set the maximum number of redraws per second
+       *
+       * When changes are made to the canvas at a higher rate, redraws will be postponed until the next permitted frame
+       * of the widget frame clock, collapsing all intermediate changes into a single redraw.
+       * \param max_frame_rate the maximum frame rate in Hz. Set to 0 (the default) to redraw as often as the frame clock allows.
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_max_frame_rate(double max_frame_rate);
+
+      /** Get the maximum number of redraws per second
+       *
+       * \return the maximum frame rate in Hz, or 0 if unlimited
+       */
+      double get_max_frame_rate();
+
       /** Get a pointer to a plot included in the canvas
        *
        * \param plot_index index of the plot in the \c plots vector
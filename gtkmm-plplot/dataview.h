@@ -0,0 +1,75 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_DATAVIEW_H
+#define GTKMMPLPLOT_DATAVIEW_H
+
+#include <cstddef>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \struct DataView dataview.h <gtkmm-plplot/dataview.h>
+     *  \brief a read-only, non-owning view of an array of doubles, with an optional stride
+     *
+     *  Views are returned by PlotData2D::get_view_x() and PlotData2D::get_view_y(), providing access to the
+     *  datapoints without copying them. A view remains valid only as long as the dataset it was obtained from is not modified or destroyed.
+     *  They are also used by PlotData2DView to describe the caller-owned memory it will plot.
+     */
+    struct DataView {
+      const double *data; ///< pointer to the first element
+      size_t size; ///< the number of elements
+      size_t stride; ///< the distance between two consecutive elements, expressed in number of doubles. A stride of 1 corresponds to a contiguous array
+
+      /** Constructor
+       *
+       * \param _data pointer to the first element
+       * \param _size the number of elements
+       * \param _stride the distance between two consecutive elements, expressed in number of doubles
+       */
+      DataView(const double *_data = nullptr, size_t _size = 0, size_t _stride = 1) :
+        data(_data), size(_size), stride(_stride) {}
+
+      /** Access an element of the view
+       *
+       * No bounds checking is performed.
+       * \param index the position of the element in the view
+       * \return a reference to the element
+       */
+      const double &operator[](size_t index) const {
+        return data[index * stride];
+      }
+
+      /** Check if the elements of the view are stored contiguously
+       *
+       * \return \c true if the stride equals 1, \c false otherwise
+       */
+      bool is_contiguous() const {
+        return stride == 1;
+      }
+
+      /** Check if the view is empty
+       *
+       * \return \c true if the view contains no elements, \c false otherwise
+       */
+      bool empty() const {
+        return size == 0;
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/decimation.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace Gtk::PLplot;
+
+void Gtk::PLplot::decimate_min_max_envelope(const double *x, const double *y, size_t n,
+                                            const PlotData2DAuxData &aux_data, size_t columns,
+                                            std::vector<double> &x_dec, std::vector<double> &y_dec) {
+  const double x0 = aux_data.log10_x ? std::log10(aux_data.world_range_x[0]) : aux_data.world_range_x[0];
+  const double x1 = aux_data.log10_x ? std::log10(aux_data.world_range_x[1]) : aux_data.world_range_x[1];
+  const double scale = columns / (x1 - x0);
+
+  //datapoints outside the plotted range end up in columns -1 and columns
+  auto get_column = [&](size_t i) -> long {
+    const double xval = aux_data.log10_x ? std::log10(x[i]) : x[i];
+    const double column = std::floor((xval - x0) * scale);
+    if (!(column >= 0.0))
+      return -1;
+    else if (column >= columns)
+      return columns;
+    return static_cast<long>(column);
+  };
+
+  auto flush_run = [&](size_t first, size_t last, size_t imin, size_t imax) {
+    size_t indices[4] = {first, std::min(imin, imax), std::max(imin, imax), last};
+    for (size_t j = 0 ; j < 4 ; j++) {
+      if (j > 0 && indices[j] == indices[j - 1])
+        continue;
+      x_dec.push_back(x[indices[j]]);
+      y_dec.push_back(y[indices[j]]);
+    }
+  };
+
+  size_t first = 0, imin = 0, imax = 0;
+  long run_column = get_column(0);
+
+  for (size_t i = 1 ; i < n ; i++) {
+    const long column = get_column(i);
+    if (column != run_column) {
+      flush_run(first, i - 1, imin, imax);
+      first = imin = imax = i;
+      run_column = column;
+      continue;
+    }
+    if (y[i] < y[imin])
+      imin = i;
+    else if (y[i] > y[imax])
+      imax = i;
+  }
+  flush_run(first, n - 1, imin, imax);
+}
+
+//Largest-Triangle-Three-Buckets, as described in Sveinn Steinarsson's thesis "Downsampling Time Series for Visual Representation"
+void Gtk::PLplot::decimate_lttb(const double *x, const double *y, size_t n,
+                                const PlotData2DAuxData &aux_data, size_t threshold,
+                                std::vector<double> &x_dec, std::vector<double> &y_dec) {
+  //the triangle areas are calculated in PLplot coordinates to account for logarithmic axes
+  auto get_x = [&](size_t i) {return aux_data.log10_x ? std::log10(x[i]) : x[i];};
+  auto get_y = [&](size_t i) {return aux_data.log10_y ? std::log10(y[i]) : y[i];};
+
+  const double bucket_size = static_cast<double>(n - 2) / (threshold - 2);
+  size_t a = 0;
+
+  x_dec.push_back(x[a]);
+  y_dec.push_back(y[a]);
+
+  for (size_t bucket = 0 ; bucket < threshold - 2 ; bucket++) {
+    //average of the next bucket
+    const size_t next_start = static_cast<size_t>((bucket + 1) * bucket_size) + 1;
+    const size_t next_end = std::min(static_cast<size_t>((bucket + 2) * bucket_size) + 1, n);
+    double avg_x = 0.0, avg_y = 0.0;
+    for (size_t i = next_start ; i < next_end ; i++) {
+      avg_x += get_x(i);
+      avg_y += get_y(i);
+    }
+    if (next_end > next_start) {
+      avg_x /= (next_end - next_start);
+      avg_y /= (next_end - next_start);
+    }
+    else {
+      avg_x = get_x(n - 1);
+      avg_y = get_y(n - 1);
+    }
+
+    //the point of the current bucket that spans the largest triangle
+    const size_t start = static_cast<size_t>(bucket * bucket_size) + 1;
+    const size_t end = static_cast<size_t>((bucket + 1) * bucket_size) + 1;
+    const double a_x = get_x(a), a_y = get_y(a);
+    double max_area = -1.0;
+    size_t next_a = start;
+    for (size_t i = start ; i < end ; i++) {
+      const double area = std::fabs((a_x - avg_x) * (get_y(i) - a_y) - (a_x - get_x(i)) * (avg_y - a_y));
+      if (area > max_area) {
+        max_area = area;
+        next_a = i;
+      }
+    }
+    x_dec.push_back(x[next_a]);
+    y_dec.push_back(y[next_a]);
+    a = next_a;
+  }
+
+  x_dec.push_back(x[n - 1]);
+  y_dec.push_back(y[n - 1]);
+}
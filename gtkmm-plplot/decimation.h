@@ -0,0 +1,62 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_DECIMATION_H
+#define GTKMMPLPLOT_DECIMATION_H
+
+#include <gtkmm-plplot/plotdata2d.h>
+#include <vector>
+
+namespace Gtk {
+  namespace PLplot {
+    /* The decimation algorithms of PlotData2D.
+     * These are used internally and are not part of the public API.
+     */
+
+    /** Reduce the datapoints to the first, last, minimum and maximum of each run of consecutive datapoints within the same pixel column
+     *
+     * The datapoints that fall outside of the plotted X-range are treated as two additional columns, on either side of the plot.
+     * \param x the X-values, in world coordinates
+     * \param y the Y-values, in world coordinates
+     * \param n the number of datapoints, must be strictly positive
+     * \param aux_data the auxiliary data of the plot the datapoints will be drawn in
+     * \param columns the number of pixel columns covered by the plotted X-range
+     * \param x_dec the X-values of the datapoints that were kept will be appended to this vector
+     * \param y_dec the Y-values of the datapoints that were kept will be appended to this vector
+     */
+    void decimate_min_max_envelope(const double *x, const double *y, size_t n,
+                                   const PlotData2DAuxData &aux_data, size_t columns,
+                                   std::vector<double> &x_dec, std::vector<double> &y_dec);
+
+    /** Reduce the datapoints using the Largest-Triangle-Three-Buckets algorithm
+     *
+     * The first and last datapoints are always kept, together with one datapoint of each of the <tt>threshold - 2</tt> buckets in between.
+     * \param x the X-values, in world coordinates, sorted in non-decreasing order
+     * \param y the Y-values, in world coordinates
+     * \param n the number of datapoints, must be larger than \c threshold
+     * \param aux_data the auxiliary data of the plot the datapoints will be drawn in
+     * \param threshold the number of datapoints to keep, must be at least 3
+     * \param x_dec the X-values of the datapoints that were kept will be appended to this vector
+     * \param y_dec the Y-values of the datapoints that were kept will be appended to this vector
+     */
+    void decimate_lttb(const double *x, const double *y, size_t n,
+                       const PlotData2DAuxData &aux_data, size_t threshold,
+                       std::vector<double> &x_dec, std::vector<double> &y_dec);
+  }
+}
+
+#endif
@@ -78,6 +78,16 @@ namespace Gtk {
       UPWARD_AND_DOWNWARD_LINES_45_DEGREES, ///< lines at 45 degrees angle upward and downward
     };
 
+    /** Controls how the line connecting the datapoints of a PlotData2D dataset is decimated before drawing
+     *
+     * To be used in combination with PlotData2D::set_decimation_mode() and PlotData2D::get_decimation_mode().
+     */
+    enum DecimationMode {
+      NO_DECIMATION = 0, ///< all datapoints are passed to PLplot. This is the default
+      MIN_MAX_ENVELOPE, ///< for each consecutive run of datapoints that falls within the same pixel column, only the first, last, minimum and maximum are drawn
+      LARGEST_TRIANGLE_THREE_BUCKETS, ///< the datapoints are reduced to roughly two per pixel column using the Largest-Triangle-Three-Buckets algorithm. Assumes the X-values are sorted
+    };
+
     /** Determines which corner of the Legend box that will be used for the normalized coordinate system.
      *
      */
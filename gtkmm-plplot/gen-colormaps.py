@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+
+# Generates colormaps.h, which embeds the control points of the PLplot
+# cmap1 palette files, so that gtkmm-plplot does not need to read them at runtime.
+#
+# Usage: gen-colormaps.py output.h palette.pal [palette.pal ...]
+#
+# The palettes must be passed in the order of the ColormapPalette enum.
+# Both file formats supported by plspal1() are accepted.
+
+import os
+import sys
+
+
+def parse_palette(filename):
+    with open(filename) as f:
+        lines = [line.strip() for line in f if line.strip()]
+
+    v2 = lines[0].startswith('v2')
+    rgb = not v2 or lines[0].split()[1] != 'hls'
+    if v2:
+        lines = lines[1:]
+
+    number_colors = int(lines[0])
+    if number_colors < 2 or len(lines) < number_colors + 1:
+        sys.exit('{}: invalid number of colors'.format(filename))
+
+    points = []
+    for line in lines[1:number_colors + 1]:
+        fields = line.split()
+        if v2:
+            if len(fields) < 4:
+                sys.exit('{}: invalid control point: {}'.format(filename, line))
+            position, c1, c2, c3 = (float(field) for field in fields[:4])
+            alpha = float(fields[4]) if len(fields) > 4 else 1.0
+            rev = int(fields[5]) if len(fields) > 5 else 0
+        else:
+            if len(fields) < 2 or len(fields[0]) != 7 or not fields[0].startswith('#'):
+                sys.exit('{}: invalid control point: {}'.format(filename, line))
+            c1, c2, c3 = (int(fields[0][i:i + 2], 16) / 255.0 for i in (1, 3, 5))
+            position = 0.01 * int(fields[1])
+            alpha = 1.0
+            rev = int(fields[2]) if len(fields) > 2 else 0
+        points.append((position, c1, c2, c3, alpha, rev != 0))
+
+    return rgb, points
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('Usage: {} output.h palette.pal [palette.pal ...]'.format(sys.argv[0]))
+
+    output = [
+        '// Generated by gen-colormaps.py from the PLplot palette files, do not edit.',
+        '',
+        '#ifndef GTKMMPLPLOT_COLORMAPS_H',
+        '#define GTKMMPLPLOT_COLORMAPS_H',
+        '',
+        '#include <cstddef>',
+        '',
+        'namespace Gtk {',
+        '  namespace PLplot {',
+        '    struct EmbeddedColormapControlPoint {',
+        '      double position;',
+        '      double c1;',
+        '      double c2;',
+        '      double c3;',
+        '      double alpha;',
+        '      bool alt_hue_path;',
+        '    };',
+        '',
+        '    struct EmbeddedColormap {',
+        '      const char *name;',
+        '      bool rgb;',
+        '      size_t n;',
+        '      const EmbeddedColormapControlPoint *points;',
+        '    };',
+        '',
+    ]
+
+    colormaps = []
+    for index, filename in enumerate(sys.argv[2:]):
+        rgb, points = parse_palette(filename)
+        array = 'colormap_points_{}'.format(index)
+        output.append('    static const EmbeddedColormapControlPoint {}[] = {{'.format(array))
+        for point in points:
+            output.append('      {{{!r}, {!r}, {!r}, {!r}, {!r}, {}}},'.format(
+                *point[:5], 'true' if point[5] else 'false'))
+        output.append('    };')
+        output.append('')
+        colormaps.append('      {{"{}", {}, {}, {}}},'.format(
+            os.path.basename(filename), 'true' if rgb else 'false', len(points), array))
+
+    output.append('    static const EmbeddedColormap embedded_colormaps[] = {')
+    output.extend(colormaps)
+    output.append('    };')
+    output.append('  }')
+    output.append('}')
+    output.append('')
+    output.append('#endif')
+
+    with open(sys.argv[1], 'w') as f:
+        f.write('\n'.join(output) + '\n')
+
+
+if __name__ == '__main__':
+    main()
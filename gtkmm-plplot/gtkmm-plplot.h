@@ -34,6 +34,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <gtkmm-plplot/plotdata2derrorx.h>
 #include <gtkmm-plplot/plotdata2derrorxy.h>
 #include <gtkmm-plplot/plotdata2derrory.h>
+#include <gtkmm-plplot/plotdata2dringbuffer.h>
+#include <gtkmm-plplot/plotdata2dview.h>
+#include <gtkmm-plplot/plotdata2dqueue.h>
+#include <gtkmm-plplot/dataview.h>
 #include <gtkmm-plplot/plotdata3d.h>
 #include <gtkmm-plplot/plotdatahistogram.h>
 #include <gtkmm-plplot/plotdatahistogrambinned.h>
@@ -47,6 +51,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <gtkmm-plplot/plotobject2dline.h>
 #include <gtkmm-plplot/plotobject2dtext.h>
 #include <gtkmm-plplot/regionselection.h>
+#include <gtkmm-plplot/renderer.h>
 #include <gtkmm-plplot/utils.h>
 
 
@@ -17,8 +17,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <gtkmm-plplot/plot.h>
 #include <gtkmm-plplot/exception.h>
+#include <gtkmm-plplot/enums.h>
 #include <gdkmm/general.h>
 #include <plstream.h>
+#include <cmath>
 
 using namespace Gtk::PLplot;
 
@@ -35,6 +37,12 @@ Plot::Plot(
   axis_title_y(_axis_title_y),
   plot_title(_plot_title),
   pls(nullptr),
+  canvas_width(0),
+  canvas_height(0),
+  plot_offset_x(0),
+  plot_offset_y(0),
+  plot_width(0),
+  plot_height(0),
   shown(true),
   background_color("Black"),
   plot_width_norm(_plot_width_norm),
@@ -42,10 +50,16 @@ Plot::Plot(
   plot_offset_horizontal_norm(_plot_offset_horizontal_norm),
   plot_offset_vertical_norm(_plot_offset_vertical_norm),
   axes_color("Black"),
-  titles_color("Black") {
+  titles_color("Black"),
+  plot_cache_valid(false),
+  recording_plot_cache(false),
+  axes_layer_valid(false) {
 
   background_color.set_alpha(0.0);
 
+  //any change to the plot or its datasets requires it to be rendered again
+  this->signal_changed().connect([this](){plot_cache_valid = false;});
+
   //connect our default signal handlers
   this->signal_changed().connect(sigc::mem_fun(*this, &Plot::on_changed));
   this->signal_data_added().connect(sigc::mem_fun(*this, &Plot::on_data_added));
@@ -166,11 +180,13 @@ void Plot::remove_object(PlotObject &plot_object_member) {
 
 void Plot::set_axis_title_x(Glib::ustring title) {
   axis_title_x = title;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
 void Plot::set_axis_title_y(Glib::ustring title) {
   axis_title_y = title;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
@@ -184,6 +200,7 @@ Glib::ustring Plot::get_axis_title_y() {
 
 void Plot::set_plot_title(Glib::ustring title) {
   plot_title = title;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
@@ -213,6 +230,7 @@ Gdk::RGBA Plot::get_axes_color() {
 
 void Plot::set_axes_color(Gdk::RGBA _axes_color) {
   axes_color = _axes_color;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
@@ -222,33 +240,234 @@ Gdk::RGBA Plot::get_titles_color() {
 
 void Plot::set_titles_color(Gdk::RGBA _titles_color) {
   titles_color = _titles_color;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
 
+bool Plot::reserve_plot_cache(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) {
+  const int cache_width = width * plot_width_norm;
+  const int cache_height = height * plot_height_norm;
+
+  if (cache_width <= 0 || cache_height <= 0) {
+    plot_cache.reset();
+    return false;
+  }
+
+  //render at the resolution of the target, to avoid blurry plots on HiDPI screens
+  double scale_x, scale_y;
+  cr->get_target()->get_device_scale(scale_x, scale_y);
+  const int surface_width = std::ceil(cache_width * scale_x);
+  const int surface_height = std::ceil(cache_height * scale_y);
+
+  if (plot_cache_valid && plot_cache &&
+      canvas_width == width && canvas_height == height &&
+      plot_cache->get_width() == surface_width &&
+      plot_cache->get_height() == surface_height)
+    return false;
+
+  if (!plot_cache || plot_cache->get_width() != surface_width || plot_cache->get_height() != surface_height)
+    plot_cache = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, surface_width, surface_height);
+  plot_cache->set_device_scale(scale_x, scale_y);
+
+  return true;
+}
+
+void Plot::draw_plot_cached(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) {
+  if (!is_showing())
+    return;
+
+  const int cache_offset_x = width * plot_offset_horizontal_norm;
+  const int cache_offset_y = height * plot_offset_vertical_norm;
+
+  if (reserve_plot_cache(cr, width, height)) {
+    auto cache_cr = Cairo::Context::create(plot_cache);
+    cache_cr->set_operator(Cairo::Context::Operator::CLEAR);
+    cache_cr->paint();
+    cache_cr->set_operator(Cairo::Context::Operator::OVER);
+    cache_cr->translate(-cache_offset_x, -cache_offset_y);
+    draw_plot(cache_cr, width, height);
+    plot_cache->flush();
+    plot_cache_valid = true;
+  }
+
+  if (!plot_cache)
+    return;
+
+  cr->save();
+  cr->set_source(plot_cache, cache_offset_x, cache_offset_y);
+  cr->paint();
+  cr->restore();
+}
+
+Cairo::RefPtr<Cairo::RecordingSurface> Plot::record_plot_cached(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) {
+  if (!is_showing() || !reserve_plot_cache(cr, width, height))
+    return Cairo::RefPtr<Cairo::RecordingSurface>();
+
+  //the recording is made at the resolution of plot_cache, so that symbol sprites and density maps are not upscaled when it is replayed
+  double scale_x, scale_y;
+  plot_cache->get_device_scale(scale_x, scale_y);
+  auto recording = Cairo::RecordingSurface::create();
+  recording->set_device_scale(scale_x, scale_y);
+  auto recording_cr = Cairo::Context::create(recording);
+  recording_cr->translate(-static_cast<int>(width * plot_offset_horizontal_norm), -static_cast<int>(height * plot_offset_vertical_norm));
+  recording_plot_cache = true;
+  try {
+    draw_plot(recording_cr, width, height);
+  }
+  catch (...) {
+    recording_plot_cache = false;
+    throw;
+  }
+  recording_plot_cache = false;
+
+  return recording;
+}
+
+void Plot::rasterize_plot_cache(const Cairo::RefPtr<Cairo::RecordingSurface> &recording) {
+  if (!recording || !plot_cache)
+    return;
+
+  auto cache_cr = Cairo::Context::create(plot_cache);
+  cache_cr->set_operator(Cairo::Context::Operator::SOURCE);
+  cache_cr->set_source(recording, 0.0, 0.0);
+  cache_cr->paint();
+  cache_cr.reset();
+  plot_cache->flush();
+  plot_cache_valid = true;
+}
+
+bool Plot::is_plot_cache_dirty() const {
+  return !plot_cache_valid;
+}
+
+void Plot::invalidate_plot_cache() {
+  plot_cache_valid = false;
+}
+
+bool Plot::is_plot_layer_supported(const Cairo::RefPtr<Cairo::Context> &cr) {
+  const Cairo::Surface::Type type = cr->get_target()->get_type();
+  return type == Cairo::Surface::Type::IMAGE || (type == Cairo::Surface::Type::RECORDING && recording_plot_cache);
+}
+
+bool Plot::is_plot_layer_reusable(const Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr) {
+  if (!layer)
+    return false;
+
+  double scale_x, scale_y, layer_scale_x, layer_scale_y;
+  cr->get_target()->get_device_scale(scale_x, scale_y);
+  layer->get_device_scale(layer_scale_x, layer_scale_y);
+
+  return scale_x == layer_scale_x && scale_y == layer_scale_y &&
+         layer->get_width() == static_cast<int>(std::ceil(plot_width * scale_x)) &&
+         layer->get_height() == static_cast<int>(std::ceil(plot_height * scale_y));
+}
+
+Cairo::RefPtr<Cairo::Context> Plot::begin_plot_layer(Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr, bool clear) {
+  if (!is_plot_layer_reusable(layer, cr)) {
+    clear = true;
+    double scale_x, scale_y;
+    cr->get_target()->get_device_scale(scale_x, scale_y);
+    layer = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32,
+                                        std::ceil(plot_width * scale_x),
+                                        std::ceil(plot_height * scale_y));
+    layer->set_device_scale(scale_x, scale_y);
+  }
+
+  auto layer_cr = Cairo::Context::create(layer);
+  if (clear) {
+    layer_cr->set_operator(Cairo::Context::Operator::CLEAR);
+    layer_cr->paint();
+    layer_cr->set_operator(Cairo::Context::Operator::OVER);
+  }
+
+  bind_plstream(layer_cr);
+
+  return layer_cr;
+}
+
+void Plot::paint_plot_layer(const Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr) {
+  layer->flush();
+
+  Cairo::RefPtr<Cairo::ImageSurface> source = layer;
+  if (cr->get_target()->get_type() == Cairo::Surface::Type::RECORDING) {
+    //the recording only references the layer, which may be drawn onto again before the recording is rasterized
+    double scale_x, scale_y;
+    layer->get_device_scale(scale_x, scale_y);
+    source = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, layer->get_width(), layer->get_height());
+    source->set_device_scale(scale_x, scale_y);
+    auto source_cr = Cairo::Context::create(source);
+    source_cr->set_operator(Cairo::Context::Operator::SOURCE);
+    source_cr->set_source(layer, 0.0, 0.0);
+    source_cr->paint();
+    source_cr.reset();
+    source->flush();
+  }
+
+  //binding the stream to cr in draw_plot_init() flipped its Y-axis: paint in the coordinates of the plot box instead
+  cr->save();
+  cr->set_matrix(canvas_matrix);
+  cr->translate(plot_offset_x, plot_offset_y);
+  cr->set_source(source, 0.0, 0.0);
+  cr->paint();
+  cr->restore();
+
+  //binding the stream flips the Y-axis again, so start from the plot box coordinates draw_plot_init() bound it with
+  cr->set_matrix(canvas_matrix);
+  cr->translate(plot_offset_x, plot_offset_y);
+  bind_plstream(cr);
+}
+
+void Plot::bind_plstream(const Cairo::RefPtr<Cairo::Context> &cr) {
+  plot_box_matrix = cr->get_matrix();
+  pls->cmd(PLESC_DEVINIT, cr->cobj());
+}
+
 void Plot::draw_plot_init(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) {
   canvas_width = width;
   canvas_height = height;
-  plot_width = width * plot_width_norm;
-  plot_height= height * plot_height_norm;
-  plot_offset_x = width * plot_offset_horizontal_norm;
-  plot_offset_y = height * plot_offset_vertical_norm;
-
-  if (pls)
-    delete pls;
-  pls = new plstream;
 
-  //add support for more colors
-  pls->scmap0n(1024);
+  const int new_plot_width = width * plot_width_norm;
+  const int new_plot_height = height * plot_height_norm;
+  const int new_plot_offset_x = width * plot_offset_horizontal_norm;
+  const int new_plot_offset_y = height * plot_offset_vertical_norm;
+
+  //the stream only needs to be (re)initialized when the page geometry changes
+  if (pls == nullptr ||
+      new_plot_width != plot_width ||
+      new_plot_height != plot_height ||
+      new_plot_offset_x != plot_offset_x ||
+      new_plot_offset_y != plot_offset_y) {
+    plot_width = new_plot_width;
+    plot_height = new_plot_height;
+    plot_offset_x = new_plot_offset_x;
+    plot_offset_y = new_plot_offset_y;
+
+    if (pls)
+      delete pls;
+    pls = new plstream;
+
+    //add support for more colors
+    pls->scmap0n(1024);
+
+    pls->sdev("extcairo");
+    pls->spage(0.0, 0.0, plot_width , plot_height, plot_offset_x, plot_offset_y);
+    pls->init();
+  }
 
-  pls->sdev("extcairo");
-  pls->spage(0.0, 0.0, plot_width , plot_height, plot_offset_x, plot_offset_y);
   Gdk::Cairo::set_source_rgba(cr, background_color);
   cr->rectangle(plot_offset_x, plot_offset_y, plot_width, plot_height);
   cr->fill();
   cr->save();
+  canvas_matrix = cr->get_matrix();
   cr->translate(plot_offset_x, plot_offset_y);
-  pls->init();
 
-  pls->cmd(PLESC_DEVINIT, cr->cobj());
+  //bind the stream to the context of this draw
+  bind_plstream(cr);
+
+  //reset the state that may have been changed while drawing the previous frame
+  pls->schr(0.0, 1.0);
+  pls->lsty(LineStyle::CONTINUOUS);
+  pls->width(PLOTDATA_DEFAULT_LINE_WIDTH);
+  pls->psty(AreaFillPattern::SOLID);
 }
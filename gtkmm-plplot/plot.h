@@ -50,7 +50,7 @@ namespace Gtk {
       Glib::ustring axis_title_x; ///< X-axis title
       Glib::ustring axis_title_y; ///< Y-axis title
       Glib::ustring plot_title;   ///< Plot title
-      plstream *pls; ///< the \c plstream object that will ensure the connection with PLplot
+      plstream *pls; ///< the \c plstream object that will ensure the connection with PLplot. It is kept alive between draws and only re-initialized when the page geometry changes.
       int canvas_width; ///< the width of the canvas in Cairo units
       int canvas_height; ///< the height of the canvas in Cairo units
       int plot_offset_x; ///< the offset of the plot with respect to the top left corner of the canvas, measured along the horizontal (X-) axis in Cairo units
@@ -65,6 +65,22 @@ namespace Gtk {
       const double plot_offset_vertical_norm; ///< the normalized vertical offset from the canvas top left corner, calculated relative to the canvas height
       Gdk::RGBA axes_color; ///< the currently used color to draw the axes, the box and gridlines. Default is opaque black
       Gdk::RGBA titles_color; ///< the currently used color to draw the axes and plot titles. Default is opaque black
+      Cairo::RefPtr<Cairo::ImageSurface> plot_cache; ///< the plot, as rendered by the last call to draw_plot_cached()
+      bool plot_cache_valid; ///< set to false whenever signal_changed() is emitted, forcing the plot to be rendered again by draw_plot_cached()
+      bool recording_plot_cache; ///< set to true while record_plot_cached() is drawing the plot: since the recording will be rasterized onto \c plot_cache, layers may be used
+      Cairo::RefPtr<Cairo::ImageSurface> axes_layer; ///< the box, axes, gridlines and titles, as rendered by the last draw onto an image surface
+      bool axes_layer_valid; ///< set to false by the setters of the properties that affect the appearance of \c axes_layer
+      Cairo::Matrix canvas_matrix; ///< the transformation matrix of the Cairo context passed to draw_plot_init(), before it was translated to the plot box
+      Cairo::Matrix plot_box_matrix; ///< the transformation matrix of the Cairo context the \c plstream is currently bound to, as it was before binding. It maps the plot box, with its origin in the top left corner, to the device space of the context
+
+      /** Make sure that \c plot_cache has the size required to cover the plot box on the target of \c cr
+       *
+       * \param cr the cairo context that the plot will be painted on
+       * \param width the width of the Canvas widget
+       * \param height the height of the Canvas widget
+       * \return \c true if the plot needs to be rendered again onto \c plot_cache, \c false if its contents can be reused
+       */
+      bool reserve_plot_cache(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height);
 
       sigc::signal<void(void)> _signal_changed; ///< signal that gets emitted whenever any of the plot parameters, or any of the contained PlotData datasets is changed.
       sigc::signal<void(PlotData *)> _signal_data_added; ///< signal emitted whenever a PlotData dataset is added to the plot
@@ -116,12 +132,60 @@ namespace Gtk {
       /** Initialization method for draw_plot.
        *
        *  Should be called by all draw_plot() methods in derived classes.
+       *  The \c plstream is created on the first call, and re-created only when the page geometry
+       *  (plot width, height or offsets) has changed since the previous call. On all other calls
+       *  the existing stream is simply bound to the new Cairo context using \c PLESC_DEVINIT.
        * \param cr Cairo context
        * \param width width of the plot in normalized coordinates
        * \param height height of the plot in normalized coordinates
        */
       virtual void draw_plot_init(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) final;
 
+      /** Check if a layer of the plot can be rendered to an offscreen surface for a draw onto \c cr
+       *
+       * Layers are only used when drawing onto image surfaces, or onto the recording surfaces made by record_plot_cached(),
+       * ensuring that vector output such as PDF or SVG is not rasterized.
+       * \param cr Cairo context, as passed to draw_plot()
+       * \return \c true if layers are supported, \c false otherwise
+       */
+      bool is_plot_layer_supported(const Cairo::RefPtr<Cairo::Context> &cr);
+
+      /** Check if a previously rendered layer matches the current plot box and the device scale of the target of \c cr
+       *
+       * \param layer the layer
+       * \param cr Cairo context, as passed to draw_plot()
+       * \return \c true if the layer can be painted without rendering it again, \c false otherwise
+       */
+      bool is_plot_layer_reusable(const Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr);
+
+      /** Prepare a layer for rendering and bind the \c plstream to it
+       *
+       * The layer will be (re)allocated if necessary, to match the current plot box, and optionally cleared.
+       * Must be called after draw_plot_init(). Until paint_plot_layer() is called, all drawing by the \c plstream will end up in the layer.
+       * \param layer the layer
+       * \param cr Cairo context, as passed to draw_plot()
+       * \param clear if \c false, the contents of a reusable layer are preserved, allowing to draw on top of them
+       * \return the Cairo context of the layer, which must be kept alive until paint_plot_layer() is called
+       */
+      Cairo::RefPtr<Cairo::Context> begin_plot_layer(Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr, bool clear = true);
+
+      /** Paint a layer onto the plot box and bind the \c plstream to \c cr again
+       *
+       * Must be called after draw_plot_init(). The state of \c cr is left as it was after draw_plot_init().
+       * When drawing onto a recording surface, a copy of the layer is painted, since the recording may be rasterized on another thread
+       * while the layer is drawn onto again.
+       * \param layer the layer
+       * \param cr Cairo context, as passed to draw_plot()
+       */
+      void paint_plot_layer(const Cairo::RefPtr<Cairo::ImageSurface> &layer, const Cairo::RefPtr<Cairo::Context> &cr);
+
+      /** Bind the \c plstream to a Cairo context, whose user space must have its origin in the top left corner of the plot box
+       *
+       * The transformation matrix of \c cr is stored in \c plot_box_matrix first, since PLplot modifies it.
+       * \param cr the Cairo context
+       */
+      void bind_plstream(const Cairo::RefPtr<Cairo::Context> &cr);
+
       /** Constructor
        *
        * This class provides a single constructor, which takes an existing PlotData dataset to construct a plot.
@@ -194,6 +258,51 @@ namespace Gtk {
        */
       //void draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, plstream *_pls, int width, int height);
       virtual void draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height) = 0;
+
+      /** Method to draw the plot with all of its datasets, reusing the result of the previous call if possible
+       *
+       * The plot is rendered with draw_plot() onto an offscreen surface that covers the plot box,
+       * which is then painted onto \c cr. As long as signal_changed() is not emitted, and the geometry of the plot
+       * and the device scale of the target of \c cr remain the same, subsequent calls will only paint this surface.
+       * Canvas uses this method to avoid rendering plots that have not changed when another plot on the same canvas is updated.
+       * \param cr the cairo context to draw to.
+       * \param width the width of the Canvas widget
+       * \param height the height of the Canvas widget
+       */
+      void draw_plot_cached(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height);
+
+      /** Check if the plot needs to be rendered again by the next call to draw_plot_cached()
+       *
+       * \return \c true if the plot changed since it was last rendered by draw_plot_cached(), \c false otherwise
+       */
+      bool is_plot_cache_dirty() const;
+
+      /** Record the plot onto a Cairo recording surface, if draw_plot_cached() would render it again
+       *
+       * This method, together with rasterize_plot_cache(), splits draw_plot_cached() in two steps,
+       * allowing the expensive rasterization to happen on a different thread.
+       * The recording is given the device scale of the offscreen surface, so that anything rasterized while recording matches its resolution.
+       * Since PLplot is not thread-safe, this method must be called on the main thread.
+       * \param cr the cairo context that draw_plot_cached() will be called with afterwards
+       * \param width the width of the Canvas widget
+       * \param height the height of the Canvas widget
+       * \return the recorded plot, which must be passed to rasterize_plot_cache(), or nullptr if the plot does not need to be rendered again
+       */
+      Cairo::RefPtr<Cairo::RecordingSurface> record_plot_cached(const Cairo::RefPtr<Cairo::Context> &cr, const int width, const int height);
+
+      /** Rasterize a recording made by record_plot_cached() onto the offscreen surface used by draw_plot_cached()
+       *
+       * This method makes no PLplot calls and may be called on any thread, concurrently for different plots.
+       * The plot must not be modified while this method is running.
+       * \param recording the recording returned by record_plot_cached()
+       */
+      void rasterize_plot_cache(const Cairo::RefPtr<Cairo::RecordingSurface> &recording);
+
+      /** Discard the offscreen rendering of the plot, forcing the next call to draw_plot_cached() to render it again
+       *
+       */
+      void invalidate_plot_cache();
+
       /** Set the X-axis title
        *
        * \param title the new X-axis title
@@ -50,7 +50,13 @@ Plot2D::Plot2D(
   RegionSelection(),
   log10_x(false),
   log10_y(false),
-  box_style(BOX_TICKS_TICK_LABELS) {
+  box_style(BOX_TICKS_TICK_LABELS),
+  axes_layer_range_x{0.0, 0.0},
+  axes_layer_range_y{0.0, 0.0},
+  incremental_rendering(false),
+  data_layer_valid(false),
+  data_layer_range_x{0.0, 0.0},
+  data_layer_range_y{0.0, 0.0} {
 
 }
 
@@ -141,6 +147,7 @@ void Plot2D::add_data(PlotData2D &data) {
     throw Exception("Gtk::PLplot::Plot2D::add_data -> Data has been added before to this plot");
 
   plot_data.push_back(&data);
+  data_layer_valid = false;
   data.signal_changed().connect([this](){_signal_changed.emit();});
   data.signal_data_modified().connect([this](){plot_data_modified();});
 
@@ -169,6 +176,7 @@ void Plot2D::remove_data(unsigned int index) {
   PlotData *removed_plot = plot_data[index];
 
   plot_data.erase(plot_data.begin() + index);
+  data_layer_valid = false;
   _signal_data_removed.emit(removed_plot);
 }
 
@@ -183,6 +191,7 @@ void Plot2D::remove_data(PlotData &plot_data_member) {
   PlotData *removed_plot = *iter;
 
   plot_data.erase(iter);
+  data_layer_valid = false;
   _signal_data_removed.emit(removed_plot);
 }
 
@@ -193,13 +202,18 @@ void Plot2D::set_axis_logarithmic_x(bool _log10) {
       throw Exception("Gtkmm::Plplot::Plot2D::set_axis_logarithmic_x -> X-axis cannot be time and logarithmic");
     for (auto &iter : plot_data) {
       auto iter2 = dynamic_cast<PlotData2D*>(iter);
-      std::vector<double> x = iter2->get_vector_x();
-      if (std::count_if(x.begin(), x.end(), [&](const double xval){return xval <= 0.0;}) > 0) {
+      const DataView view_x = iter2->get_view_x();
+      bool positive = true;
+      for (size_t i = 0 ; i < view_x.size && positive ; i++)
+        positive = view_x[i] > 0.0;
+      if (!positive) {
         throw Exception("Gtkmm::Plplot::Plot2D::set_axis_logarithmic_x -> plot X-values must be strictly positive");
       }
     }
   }
   log10_x = _log10;
+  axes_layer_valid = false;
+  data_layer_valid = false;
   plot_data_modified();
 }
 
@@ -208,13 +222,18 @@ void Plot2D::set_axis_logarithmic_y(bool _log10) {
   if (_log10) {
     for (auto &iter : plot_data) {
       auto iter2 = dynamic_cast<PlotData2D*>(iter);
-      std::vector<double> y = iter2->get_vector_y();
-      if (std::count_if(y.begin(), y.end(), [&](const double yval){return yval <= 0.0;}) > 0) {
+      const DataView view_y = iter2->get_view_y();
+      bool positive = true;
+      for (size_t i = 0 ; i < view_y.size && positive ; i++)
+        positive = view_y[i] > 0.0;
+      if (!positive) {
         throw Exception("Gtkmm::Plplot::Plot2D::set_axis_logarithmic_y -> plot Y-values must be strictly positive");
       }
     }
   }
   log10_y = _log10;
+  axes_layer_valid = false;
+  data_layer_valid = false;
   plot_data_modified();
 }
 
@@ -233,6 +252,7 @@ void Plot2D::set_axis_time_format_x(Glib::ustring _time_format) {
     }
   }
   time_format = _time_format;
+  axes_layer_valid = false;
   plot_data_modified();
 }
 
@@ -243,10 +263,12 @@ Glib::ustring  Plot2D::get_axis_time_format_x() {
 void Plot2D::config_time_x(double _scale, const Glib::DateTime& _time) {
   time_scale = _scale;
   time_start = _time;
+  axes_layer_valid = false;
 }
 
 void Plot2D::set_box_style(BoxStyle _box_style) {
   box_style = _box_style;
+  axes_layer_valid = false;
   _signal_changed.emit();
 }
 
@@ -254,6 +276,21 @@ BoxStyle Plot2D::get_box_style() {
   return box_style;
 }
 
+void Plot2D::set_incremental_rendering(bool _incremental_rendering) {
+  if (_incremental_rendering == incremental_rendering)
+    return;
+
+  incremental_rendering = _incremental_rendering;
+  data_layer_valid = false;
+  if (!incremental_rendering)
+    data_layer.reset();
+  _signal_changed.emit();
+}
+
+bool Plot2D::get_incremental_rendering() {
+  return incremental_rendering;
+}
+
 void Plot2D::coordinate_transform_world_to_plplot(double x_old, double y_old, double *x_new, double *y_new, PLPointer object) {
   Plot2D *plot2d = static_cast<Plot2D*>(object);
 
@@ -331,21 +368,41 @@ void Plot2D::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const int width,
   // g_debug("Plot2D::draw_plot -> plotted_range_x: %g  %g", plotted_range_x[0], plotted_range_x[1]);
   // g_debug("Plot2D::draw_plot -> plotted_range_y: %g  %g", plotted_range_y[0], plotted_range_y[1]);
 
-  //plot the box with its axes
-  pls->env(plotted_range_x[0], plotted_range_x[1],
-           plotted_range_y[0], plotted_range_y[1],
-           0, plplot_axis_style);
-
-  //set the label color
-  change_plstream_color(pls, titles_color);
-
-  pls->lab(axis_title_x.c_str(), axis_title_y.c_str(), plot_title.c_str());
-
-  //hook up the coordinate transform
-  pls->stransform(&Plot2D::coordinate_transform_world_to_plplot, this);
-
-  for (auto &iter : plot_data) {
-    iter->draw_plot_data(cr, pls);
+  //the box, axes and titles are rendered to a separate layer, which is reused for as long as they do not change
+  const bool use_axes_layer = is_plot_layer_supported(cr);
+
+  if (use_axes_layer && axes_layer_valid && is_plot_layer_reusable(axes_layer, cr) &&
+      axes_layer_range_x[0] == plotted_range_x[0] && axes_layer_range_x[1] == plotted_range_x[1] &&
+      axes_layer_range_y[0] == plotted_range_y[0] && axes_layer_range_y[1] == plotted_range_y[1]) {
+    //only set up the viewport and window
+    pls->env(plotted_range_x[0], plotted_range_x[1],
+             plotted_range_y[0], plotted_range_y[1],
+             0, -2);
+    paint_plot_layer(axes_layer, cr);
+  }
+  else {
+    Cairo::RefPtr<Cairo::Context> axes_layer_cr;
+    if (use_axes_layer)
+      axes_layer_cr = begin_plot_layer(axes_layer, cr);
+
+    //plot the box with its axes
+    pls->env(plotted_range_x[0], plotted_range_x[1],
+             plotted_range_y[0], plotted_range_y[1],
+             0, plplot_axis_style);
+
+    //set the label color
+    change_plstream_color(pls, titles_color);
+
+    pls->lab(axis_title_x.c_str(), axis_title_y.c_str(), plot_title.c_str());
+
+    if (use_axes_layer) {
+      paint_plot_layer(axes_layer, cr);
+      axes_layer_range_x[0] = plotted_range_x[0];
+      axes_layer_range_x[1] = plotted_range_x[1];
+      axes_layer_range_y[0] = plotted_range_y[0];
+      axes_layer_range_y[1] = plotted_range_y[1];
+      axes_layer_valid = true;
+    }
   }
 
   double world_range_x[2];
@@ -354,6 +411,69 @@ void Plot2D::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const int width,
   coordinate_transform_plplot_to_world(plotted_range_x[0], plotted_range_y[0], world_range_x[0], world_range_y[0]);
   coordinate_transform_plplot_to_world(plotted_range_x[1], plotted_range_y[1], world_range_x[1], world_range_y[1]);
 
+  //the size of the viewport in Cairo units
+  double viewport_xmin, viewport_xmax, viewport_ymin, viewport_ymax;
+  pls->gvpd(viewport_xmin, viewport_xmax, viewport_ymin, viewport_ymax);
+
+  PlotData2DAuxData data_aux_data(world_range_x, world_range_y, log10_x, log10_y,
+                                  (viewport_xmax - viewport_xmin) * plot_width,
+                                  (viewport_ymax - viewport_ymin) * plot_height);
+
+  //the affine transformation from PLplot coordinates to the plot box, allowing datasets to draw onto Cairo directly
+  double window_xmin, window_xmax, window_ymin, window_ymax;
+  pls->gvpw(window_xmin, window_xmax, window_ymin, window_ymax);
+  data_aux_data.cairo_transform_valid = true;
+  data_aux_data.plplot_to_plot_box[0] = (viewport_xmax - viewport_xmin) * plot_width / (window_xmax - window_xmin);
+  data_aux_data.plplot_to_plot_box[1] = viewport_xmin * plot_width - data_aux_data.plplot_to_plot_box[0] * window_xmin;
+  data_aux_data.plplot_to_plot_box[2] = -(viewport_ymax - viewport_ymin) * plot_height / (window_ymax - window_ymin);
+  data_aux_data.plplot_to_plot_box[3] = (1.0 - viewport_ymin) * plot_height - data_aux_data.plplot_to_plot_box[2] * window_ymin;
+  data_aux_data.viewport_plot_box[0] = viewport_xmin * plot_width;
+  data_aux_data.viewport_plot_box[1] = (1.0 - viewport_ymax) * plot_height;
+  data_aux_data.viewport_plot_box[2] = (viewport_xmax - viewport_xmin) * plot_width;
+  data_aux_data.viewport_plot_box[3] = (viewport_ymax - viewport_ymin) * plot_height;
+
+  //hook up the coordinate transform. The datasets uninstall it whenever they pass coordinates they converted themselves,
+  //using cached logarithms where possible, so it only applies to world coordinates passed to PLplot directly
+  pls->stransform(&Plot2D::coordinate_transform_world_to_plplot, this);
+  data_aux_data.coordinate_transform = &Plot2D::coordinate_transform_world_to_plplot;
+  data_aux_data.coordinate_transform_data = this;
+
+  if (incremental_rendering && is_plot_layer_supported(cr)) {
+    //only the appended datapoints need to be drawn if nothing else changed since the previous draw
+    bool incremental = data_layer_valid && is_plot_layer_reusable(data_layer, cr) &&
+      data_layer_range_x[0] == plotted_range_x[0] && data_layer_range_x[1] == plotted_range_x[1] &&
+      data_layer_range_y[0] == plotted_range_y[0] && data_layer_range_y[1] == plotted_range_y[1];
+
+    for (auto &iter : plot_data)
+      incremental = incremental && dynamic_cast<PlotData2D*>(iter)->can_draw_incrementally();
+
+    auto data_layer_cr = begin_plot_layer(data_layer, cr, !incremental);
+    data_aux_data.plot_box_matrix = plot_box_matrix;
+
+    for (auto &iter : plot_data) {
+      auto iter2 = dynamic_cast<PlotData2D*>(iter);
+      if (incremental)
+        iter2->draw_plot_data_incremental(data_layer_cr, pls, data_aux_data);
+      else
+        iter2->draw_plot_data(data_layer_cr, pls, data_aux_data);
+      iter2->mark_rendered();
+    }
+
+    paint_plot_layer(data_layer, cr);
+    data_layer_range_x[0] = plotted_range_x[0];
+    data_layer_range_x[1] = plotted_range_x[1];
+    data_layer_range_y[0] = plotted_range_y[0];
+    data_layer_range_y[1] = plotted_range_y[1];
+    data_layer_valid = true;
+  }
+  else {
+    data_aux_data.plot_box_matrix = plot_box_matrix;
+    for (auto &iter : plot_data) {
+      auto iter2 = dynamic_cast<PlotData2D*>(iter);
+      iter2->draw_plot_data(cr, pls, data_aux_data);
+    }
+  }
+
   PlotObject2DAuxData aux_data(world_range_x, world_range_y);
 
   for (auto &iter : plot_objects) {
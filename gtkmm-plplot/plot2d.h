@@ -49,6 +49,13 @@ namespace Gtk {
       Glib::ustring time_format; ///< the time format to use date / time in the X-axis
       double time_scale = 1. / 86400; ///< the time scale in fraction of day when converting from date/time to double
       Glib::DateTime time_start = Glib::DateTime::create_utc(1970,1,1,0,0,0); ///< the time start when converting from date/time to double
+      double axes_layer_range_x[2]; ///< the plotted X-range that was used to render \c axes_layer
+      double axes_layer_range_y[2]; ///< the plotted Y-range that was used to render \c axes_layer
+      bool incremental_rendering; ///< \c true if the datasets are rendered to \c data_layer, allowing appended datapoints to be drawn on top of the previous rendering
+      Cairo::RefPtr<Cairo::ImageSurface> data_layer; ///< the datasets, as rendered by the last draw in incremental rendering mode
+      bool data_layer_valid; ///< set to false when datasets are added or removed, or when their properties change
+      double data_layer_range_x[2]; ///< the plotted X-range that was used to render \c data_layer
+      double data_layer_range_y[2]; ///< the plotted Y-range that was used to render \c data_layer
 
       Plot2D() = delete; ///< no default constructor
       Plot2D(const Plot2D &) = delete; ///< no default copy constructor
@@ -203,6 +210,25 @@ namespace Gtk {
        */
       BoxStyle get_box_style();
 
+      /** Enable or disable incremental rendering of the datasets
+       *
+       * In incremental rendering mode, the datasets are rendered to an offscreen layer that is kept between draws.
+       * As long as the plotted range does not change, and datapoints are only appended to the datasets,
+       * only the new datapoints will be drawn on top of this layer, making the cost of a redraw proportional to the number of new datapoints.
+       * The datasets will be drawn completely whenever the plotted range changes, datasets are added or removed,
+       * datapoints are removed or replaced, or any of the properties of the datasets change.
+       * Datasets whose type does not support incremental drawing, such as those with errorbars, will always cause a complete redraw.
+       * Incremental rendering is only used when drawing onto image surfaces, and is disabled by default.
+       * \param incremental_rendering \c true to enable incremental rendering, \c false to disable it
+       */
+      void set_incremental_rendering(bool incremental_rendering);
+
+      /** Check if incremental rendering of the datasets is enabled
+       *
+       * \return \c true if incremental rendering is enabled, \c false otherwise
+       */
+      bool get_incremental_rendering();
+
 
       /** Sets the scaling of the X-axis to logarithmic
        *
@@ -81,13 +81,13 @@ PlotContour::~PlotContour() {}
 
 void PlotContour::plot_data_modified() {
   auto data = dynamic_cast<PlotDataSurface*>(plot_data[0]);
-  std::vector<double> x = data->get_vector_x();
-  std::vector<double> y = data->get_vector_y();
+  const DataView x = data->get_view_x();
+  const DataView y = data->get_view_y();
 
-  plot_data_range_x[0] = x.front();
-  plot_data_range_x[1] = x.back();
-  plot_data_range_y[0] = y.front();
-  plot_data_range_y[1] = y.back();
+  plot_data_range_x[0] = x[0];
+  plot_data_range_x[1] = x[x.size - 1];
+  plot_data_range_y[0] = y[0];
+  plot_data_range_y[1] = y[y.size - 1];
 
   //This function won't do anything as I am using the default implementation
   //provided by Plot
@@ -106,9 +106,7 @@ void PlotContour::plot_data_modified() {
   plotted_range_y[1] = plot_data_range_y[1];
 
   //get maximum of z
-  double **z = data->get_array2d_z();
-  plMinMax2dGrid(z, x.size(), y.size(), &zmax, &zmin);
-  free_array2d((void **) z, x.size());
+  plMinMax2dGrid(data->get_view_z(), x.size, y.size, &zmax, &zmin);
 
   //fill up level
   for (unsigned int i = 0 ; i < nlevels ; i++) {
@@ -224,20 +222,19 @@ void PlotContour::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const int w
   pls->width(edge_width);
 
   auto data = dynamic_cast<PlotDataSurface*>(plot_data[0]);
-  std::vector<double> x = data->get_vector_x();
-  std::vector<double> y = data->get_vector_y();
+  const DataView x = data->get_view_x();
+  const DataView y = data->get_view_y();
   PLcGrid cgrid;
-  cgrid.xg = &x[0];
-  cgrid.yg = &y[0];
-  cgrid.nx = x.size();
-  cgrid.ny = y.size();
-  double **z = data->get_array2d_z();
+  //the grid is only read by the transformation callback
+  cgrid.xg = const_cast<double *>(x.data);
+  cgrid.yg = const_cast<double *>(y.data);
+  cgrid.nx = x.size;
+  cgrid.ny = y.size;
+  const double * const *z = data->get_view_z();
 
 	pls->setcontlabelparam(0.01, 0.6, 0.1, is_showing_labels());
 
-  pls->cont(z, x.size(), y.size(), 1, x.size(), 1, y.size(), &clevels[0], nlevels, plcallback::tr1, (void *) &cgrid);
-
-  free_array2d((void **) z, x.size());
+  pls->cont(z, x.size, y.size, 1, x.size, 1, y.size, &clevels[0], nlevels, plcallback::tr1, (void *) &cgrid);
 
   cr->restore();
 
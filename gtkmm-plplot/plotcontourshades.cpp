@@ -179,14 +179,15 @@ void PlotContourShades::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const
 	pls->psty(area_fill_pattern);
 
   auto data = dynamic_cast<PlotDataSurface*>(plot_data[0]);
-  std::vector<double> x = data->get_vector_x();
-  std::vector<double> y = data->get_vector_y();
+  const DataView x = data->get_view_x();
+  const DataView y = data->get_view_y();
   PLcGrid cgrid;
-  cgrid.xg = &x[0];
-  cgrid.yg = &y[0];
-  cgrid.nx = x.size();
-  cgrid.ny = y.size();
-  double **z = data->get_array2d_z();
+  //the grid is only read by the transformation callback
+  cgrid.xg = const_cast<double *>(x.data);
+  cgrid.yg = const_cast<double *>(y.data);
+  cgrid.nx = x.size;
+  cgrid.ny = y.size;
+  const double * const *z = data->get_view_z();
 
 	int cont_color = GTKMM_PLPLOT_DEFAULT_COLOR_INDEX;
 	double cont_width = edge_width;
@@ -199,7 +200,7 @@ void PlotContourShades::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const
 	//this will only work if showing_edges is true!
 	pls->setcontlabelparam(0.01, 0.6, 0.1, is_showing_labels());
 
-	pls->shades(z, x.size(), y.size(), NULL, x.front(), x.back(), y.front(), y.back(),
+	pls->shades(z, x.size, y.size, NULL, x[0], x[x.size - 1], y[0], y[y.size - 1],
               &clevels[0], nlevels, fill_width,
               cont_color, cont_width,
               plcallback::fill, true, plcallback::tr1, (void *) &cgrid);
@@ -209,8 +210,6 @@ void PlotContourShades::draw_plot(const Cairo::RefPtr<Cairo::Context> &cr, const
   if (showing_colorbar)
     draw_colorbar(cr, pls);
 
-  free_array2d((void **) z, x.size());
-
 
   //plot the box with its axes
   change_plstream_color(pls, axes_color);
@@ -16,9 +16,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <gtkmm-plplot/plotdata2d.h>
+#include <gtkmm-plplot/decimation.h>
 #include <gtkmm-plplot/exception.h>
 #include <gtkmm-plplot/utils.h>
+#include <gdkmm/general.h>
+#include <pangomm/layout.h>
 #include <plstream.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
 
 using namespace Gtk::PLplot;
 
@@ -32,12 +39,48 @@ PlotData2D::PlotData2D(
   PlotDataLine(_color, _line_style, _line_width),
   x(_x), y(_y),
   symbol(""), symbol_color(Gdk::RGBA("Red")),
-  symbol_scale_factor(1.0) {
+  symbol_scale_factor(1.0),
+  decimation_mode(NO_DECIMATION),
+  draw_aux_data(nullptr),
+  lod_enabled(false),
+  lod_size(0),
+  x_sorted_size(0),
+  x_unsorted_position(0),
+  incremental_size(0),
+  incremental_valid(false),
+  incremental_shown(false),
+  plplot_x_cache_size(0),
+  plplot_y_cache_size(0),
+  evicted_size(0),
+  fast_line_rendering(false),
+  symbol_sprites(false),
+  symbol_sprite_height(0.0),
+  symbol_sprite_scale(0.0),
+  symbol_sprite_origin_x(0.0),
+  symbol_sprite_origin_y(0.0),
+  density_mode(false),
+  density_colormap(BLUE_YELLOW),
+  density_cell_size(1),
+  extremes_valid(false),
+  extremes_xmin(0),
+  extremes_xmax(0),
+  extremes_ymin(0),
+  extremes_ymax(0) {
 
    //ensure both arrays have the same size
   if (x.size() != y.size()) {
     throw Exception("Gtk::PLplot::PlotData2D::PlotData2D -> data arrays x and y must have the same size!");
   }
+
+  //changes to the properties require the dataset to be drawn completely
+  this->signal_changed().connect([this](){incremental_valid = false;});
+
+  //the symbol, its color or its scale factor may have changed
+  this->signal_changed().connect([this](){symbol_sprite.reset();});
+
+  //the point-density map depends on both the datapoints and the properties
+  this->signal_changed().connect([this](){density_map.reset();});
+  this->signal_data_modified().connect([this](){density_map.reset();});
 }
 
 PlotData2D::PlotData2D(
@@ -97,9 +140,98 @@ double PlotData2D::get_symbol_height_scale_factor() {
   return symbol_scale_factor;
 }
 
+void PlotData2D::set_decimation_mode(DecimationMode _decimation_mode) {
+  if (decimation_mode == _decimation_mode)
+    return;
+  decimation_mode = _decimation_mode;
+  _signal_changed.emit();
+}
+
+DecimationMode PlotData2D::get_decimation_mode() {
+  return decimation_mode;
+}
+
+void PlotData2D::set_level_of_detail(bool _enable) {
+  if (lod_enabled == _enable)
+    return;
+  lod_enabled = _enable;
+  invalidate_level_of_detail();
+  if (!lod_enabled) {
+    lod_min_index.clear();
+    lod_min_index.shrink_to_fit();
+    lod_max_index.clear();
+    lod_max_index.shrink_to_fit();
+  }
+  _signal_changed.emit();
+}
+
+bool PlotData2D::get_level_of_detail() {
+  return lod_enabled;
+}
+
+void PlotData2D::set_fast_line_rendering(bool _enable) {
+  if (fast_line_rendering == _enable)
+    return;
+  fast_line_rendering = _enable;
+  _signal_changed.emit();
+}
+
+bool PlotData2D::get_fast_line_rendering() {
+  return fast_line_rendering;
+}
+
+void PlotData2D::set_symbol_sprites(bool _enable) {
+  if (symbol_sprites == _enable)
+    return;
+  symbol_sprites = _enable;
+  _signal_changed.emit();
+}
+
+bool PlotData2D::get_symbol_sprites() {
+  return symbol_sprites;
+}
+
+void PlotData2D::set_density_mode(bool _enable) {
+  if (density_mode == _enable)
+    return;
+  density_mode = _enable;
+  _signal_changed.emit();
+}
+
+bool PlotData2D::get_density_mode() {
+  return density_mode;
+}
+
+void PlotData2D::set_density_colormap(ColormapPalette _colormap) {
+  if (density_colormap == _colormap)
+    return;
+  density_colormap = _colormap;
+  density_palette.clear();
+  _signal_changed.emit();
+}
+
+ColormapPalette PlotData2D::get_density_colormap() {
+  return density_colormap;
+}
+
+void PlotData2D::set_density_cell_size(unsigned int _cell_size) {
+  if (_cell_size == 0) {
+    throw Exception("Gtk::PLplot::PlotData2D::set_density_cell_size -> cell_size must be strictly positive");
+  }
+  if (density_cell_size == _cell_size)
+    return;
+  density_cell_size = _cell_size;
+  _signal_changed.emit();
+}
+
+unsigned int PlotData2D::get_density_cell_size() {
+  return density_cell_size;
+}
+
 void PlotData2D::add_datapoint(double _x, double _y) {
   x.push_back(_x);
   y.push_back(_y);
+  extremes_add_datapoint(x.size() - 1);
   _signal_data_modified.emit();
 }
 
@@ -107,10 +239,47 @@ void PlotData2D::add_datapoint(std::pair<double, double> _xy_pair) {
   add_datapoint(_xy_pair.first, _xy_pair.second);
 }
 
+void PlotData2D::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  //ensure both arrays have the same size
+  if (_x.size() != _y.size()) {
+    throw Exception("Gtk::PLplot::PlotData2D::append_datapoints -> data arrays x and y must have the same size!");
+  }
+  append_datapoints(_x.data(), _y.data(), _x.size());
+}
+
+void PlotData2D::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  //ensure both arrays have the same size
+  if (_x.size() != _y.size()) {
+    throw Exception("Gtk::PLplot::PlotData2D::append_datapoints -> data arrays x and y must have the same size!");
+  }
+  append_datapoints(std::begin(_x), std::begin(_y), _x.size());
+}
+
+void PlotData2D::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  if (_n == 0)
+    return;
+
+  if (_x == nullptr || _y == nullptr) {
+    throw Exception("Gtk::PLplot::PlotData2D::append_datapoints -> data arrays x and y cannot be NULL!");
+  }
+
+  size_t first = x.size();
+  //a single range insert allocates at most once per call, while preserving geometric growth
+  x.insert(x.end(), _x, _x + _n);
+  y.insert(y.end(), _y, _y + _n);
+
+  for (size_t i = first ; i < x.size() ; i++)
+    extremes_add_datapoint(i);
+
+  _signal_data_modified.emit();
+}
+
 void PlotData2D::remove_datapoint(size_t _index) {
   if (_index >= x.size()) {
     throw Exception("Gtk::PLplot::PlotData2D::remove_datapoint -> invalid index!");
   }
+  extremes_remove_datapoint(_index);
+  invalidate_datapoint_caches();
   x.erase(x.begin() + _index);
   y.erase(y.begin() + _index);
   _signal_data_modified.emit();
@@ -127,15 +296,894 @@ void PlotData2D::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstrea
     change_plstream_color(pls, color);
     pls->lsty(line_style);
     pls->width(line_width);
-    pls->line(x.size(), x_pl, y_pl);
+    draw_line(pls, x_pl, y_pl, x.size());
   }
 
   // plot the symbols if requested
   if (!symbol.empty()) {
     change_plstream_color(pls, symbol_color);
     pls->schr(0, symbol_scale_factor);
-    pls->string(x.size(), x_pl, y_pl, symbol.c_str());
+    draw_symbols(pls, x_pl, y_pl, x.size());
+  }
+}
+
+void PlotData2D::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls, const PlotData2DAuxData &aux_data) {
+  draw_aux_data = &aux_data;
+  draw_context = cr;
+  try {
+    if (density_mode && aux_data.cairo_transform_valid)
+      draw_density_map(cr);
+    else
+      draw_plot_data(cr, pls);
+  }
+  catch (...) {
+    draw_aux_data = nullptr;
+    draw_context.reset();
+    throw;
+  }
+  draw_aux_data = nullptr;
+  draw_context.reset();
+}
+
+void PlotData2D::draw_plot_data_incremental(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls, const PlotData2DAuxData &aux_data) {
+  const size_t n = x.size();
+
+  if (!is_showing() || n <= incremental_size)
+    return;
+
+  draw_aux_data = &aux_data;
+  draw_context = cr;
+  try {
+    // plot the line if requested, starting from the last datapoint that was drawn before
+    const size_t first = incremental_size > 0 ? incremental_size - 1 : 0;
+    if (line_style != LineStyle::NONE && n - first >= 2) {
+      change_plstream_color(pls, color);
+      pls->lsty(line_style);
+      pls->width(line_width);
+      draw_line(pls, &x[first], &y[first], n - first);
+    }
+
+    // plot the symbols if requested
+    if (!symbol.empty()) {
+      change_plstream_color(pls, symbol_color);
+      pls->schr(0, symbol_scale_factor);
+      draw_symbols(pls, &x[incremental_size], &y[incremental_size], n - incremental_size);
+    }
+  }
+  catch (...) {
+    draw_aux_data = nullptr;
+    draw_context.reset();
+    throw;
+  }
+  draw_aux_data = nullptr;
+  draw_context.reset();
+}
+
+bool PlotData2D::is_incremental_drawing_supported() {
+  return true;
+}
+
+bool PlotData2D::can_draw_incrementally() {
+  return !density_mode &&
+         is_incremental_drawing_supported() &&
+         incremental_valid &&
+         incremental_shown == is_showing() &&
+         incremental_size <= size();
+}
+
+void PlotData2D::mark_rendered() {
+  incremental_size = size();
+  incremental_valid = true;
+  incremental_shown = is_showing();
+}
+
+bool PlotData2D::is_x_sorted() {
+  const DataView view_x = get_storage_view_x();
+
+  if (x_sorted_size > evicted_size + view_x.size)
+    invalidate_datapoint_caches();
+
+  //only the X-values that were added since the last call need to be checked,
+  //and only the last position where the order is broken matters: it may be evicted later on
+  for (size_t i = std::max(x_sorted_size, evicted_size + 1) ; i < evicted_size + view_x.size ; i++) {
+    if (!(view_x[i - evicted_size - 1] <= view_x[i - evicted_size]))
+      x_unsorted_position = i;
   }
+  x_sorted_size = evicted_size + view_x.size;
+
+  return x_unsorted_position <= evicted_size;
+}
+
+bool PlotData2D::get_visible_range(size_t first, size_t _n, size_t &lo, size_t &hi) {
+  if (draw_aux_data == nullptr || _n == 0 || !is_x_sorted())
+    return false;
+
+  const DataView view_x = get_storage_view_x();
+  const double xmin = std::min(draw_aux_data->world_range_x[0], draw_aux_data->world_range_x[1]);
+  const double xmax = std::max(draw_aux_data->world_range_x[0], draw_aux_data->world_range_x[1]);
+
+  //binary searches for the first element not less than xmin, and the first element greater than xmax
+  size_t begin = first, end = first + _n;
+  while (begin < end) {
+    const size_t middle = begin + (end - begin) / 2;
+    if (view_x[middle] < xmin)
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+  lo = begin - first;
+
+  end = first + _n;
+  while (begin < end) {
+    const size_t middle = begin + (end - begin) / 2;
+    if (!(xmax < view_x[middle]))
+      begin = middle + 1;
+    else
+      end = middle;
+  }
+  hi = begin - first;
+
+  //include one datapoint on either side, to ensure the line continues up to the edges of the plot
+  if (lo > 0)
+    lo--;
+  if (hi < _n)
+    hi++;
+
+  return true;
+}
+
+bool PlotData2D::get_visible_slice(const double *_x, size_t _n, size_t &lo, size_t &hi) {
+  const DataView view_x = get_storage_view_x();
+
+  //the binary search requires the X-values to be part of the contiguous storage
+  std::less_equal<const double *> less_equal;
+  if (_n == 0 || !view_x.is_contiguous() || !less_equal(view_x.data, _x) || !less_equal(_x + _n, view_x.data + view_x.size))
+    return false;
+
+  return get_visible_range(_x - view_x.data, _n, lo, hi);
+}
+
+void PlotData2D::draw_line(plstream *pls, const double *_x, const double *_y, size_t _n) {
+  if (draw_aux_data == nullptr || _n < 2) {
+    plot_line(pls, _x, _y, _n);
+    return;
+  }
+
+  //the level-of-detail pyramid covers the complete dataset only
+  const DataView view_x = get_storage_view_x();
+  const DataView view_y = get_storage_view_y();
+  if (lod_enabled && view_x.is_contiguous() && view_y.is_contiguous() &&
+      _x == view_x.data && _y == view_y.data && _n == view_x.size && is_x_sorted()) {
+    update_level_of_detail();
+    draw_line_level_of_detail(pls);
+    return;
+  }
+
+  size_t lo, hi;
+  if (get_visible_slice(_x, _n, lo, hi)) {
+    if (hi - lo >= 2)
+      draw_line_decimated(pls, _x + lo, _y + lo, hi - lo);
+    return;
+  }
+
+  //unsorted X-values: only keep the runs of segments whose bounding box overlaps with the plotted window
+  const double xmin = std::min(draw_aux_data->world_range_x[0], draw_aux_data->world_range_x[1]);
+  const double xmax = std::max(draw_aux_data->world_range_x[0], draw_aux_data->world_range_x[1]);
+  const double ymin = std::min(draw_aux_data->world_range_y[0], draw_aux_data->world_range_y[1]);
+  const double ymax = std::max(draw_aux_data->world_range_y[0], draw_aux_data->world_range_y[1]);
+
+  auto is_segment_outside = [&](size_t i) {
+    return (_x[i] < xmin && _x[i + 1] < xmin) || (_x[i] > xmax && _x[i + 1] > xmax) ||
+           (_y[i] < ymin && _y[i + 1] < ymin) || (_y[i] > ymax && _y[i + 1] > ymax);
+  };
+
+  //each run gets the share of the pixel columns that its X-values cover within the plotted window
+  auto draw_run = [&](size_t start, size_t n) {
+    auto [run_xmin_iter, run_xmax_iter] = std::minmax_element(_x + start, _x + start + n);
+    const double run_xmin = std::max(*run_xmin_iter, xmin);
+    const double run_xmax = std::min(*run_xmax_iter, xmax);
+    double share = 1.0;
+    if (draw_aux_data->log10_x && xmin > 0.0 && xmax > xmin)
+      share = std::log10(run_xmax / run_xmin) / std::log10(xmax / xmin);
+    else if (!draw_aux_data->log10_x && xmax > xmin)
+      share = (run_xmax - run_xmin) / (xmax - xmin);
+    draw_line_decimated(pls, _x + start, _y + start, n, std::min(1.0, std::max(share, 0.0)));
+  };
+
+  const size_t no_run = static_cast<size_t>(-1);
+  size_t run_start = no_run;
+
+  for (size_t i = 0 ; i < _n - 1 ; i++) {
+    if (!is_segment_outside(i)) {
+      if (run_start == no_run)
+        run_start = i;
+    }
+    else if (run_start != no_run) {
+      draw_run(run_start, i + 1 - run_start);
+      run_start = no_run;
+    }
+  }
+
+  if (run_start != no_run)
+    draw_run(run_start, _n - run_start);
+}
+
+void PlotData2D::draw_symbols(plstream *pls, const double *_x, const double *_y, size_t _n) {
+  size_t lo, hi;
+  if (get_visible_slice(_x, _n, lo, hi)) {
+    _x += lo;
+    _y += lo;
+    _n = hi - lo;
+  }
+
+  plot_symbols(pls, _x, _y, _n);
+}
+
+//a plain loop over contiguous memory
+static void log10_array(const double *values, size_t n, double *log10_values) {
+  for (size_t i = 0 ; i < n ; i++)
+    log10_values[i] = std::log10(values[i]);
+}
+
+static const double *get_plplot_coordinates(const double *values, size_t n, bool log10, const DataView &storage, size_t evicted_size,
+                                            std::vector<double> &cache, size_t &cache_size, std::vector<double> &buffer) {
+  if (!log10 || n == 0)
+    return values;
+
+  std::less_equal<const double *> less_equal;
+  if (storage.is_contiguous() && less_equal(storage.data, values) && less_equal(values + n, storage.data + storage.size)) {
+    //only the values that were added since the cache was last updated need to be converted
+    const size_t end = evicted_size + storage.size;
+    if (cache_size > end || cache_size < evicted_size)
+      cache_size = evicted_size;
+    cache.resize(end);
+    log10_array(storage.data + (cache_size - evicted_size), end - cache_size, cache.data() + cache_size);
+    cache_size = end;
+    return cache.data() + evicted_size + (values - storage.data);
+  }
+
+  buffer.resize(n);
+  log10_array(values, n, buffer.data());
+  return buffer.data();
+}
+
+const double *PlotData2D::get_plplot_x(const double *_x, size_t _n, std::vector<double> &buffer) {
+  return get_plplot_coordinates(_x, _n, draw_aux_data != nullptr && draw_aux_data->log10_x, get_storage_view_x(), evicted_size,
+                                plplot_x_cache, plplot_x_cache_size, buffer);
+}
+
+const double *PlotData2D::get_plplot_y(const double *_y, size_t _n, std::vector<double> &buffer) {
+  return get_plplot_coordinates(_y, _n, draw_aux_data != nullptr && draw_aux_data->log10_y, get_storage_view_y(), evicted_size,
+                                plplot_y_cache, plplot_y_cache_size, buffer);
+}
+
+void PlotData2D::plot_line(plstream *pls, const double *_x, const double *_y, size_t _n) {
+  const double *x_pl = get_plplot_x(_x, _n, plplot_x_buffer);
+  const double *y_pl = get_plplot_y(_y, _n, plplot_y_buffer);
+
+  if (fast_line_rendering && draw_context && draw_aux_data != nullptr && draw_aux_data->cairo_transform_valid) {
+    stroke_line(x_pl, y_pl, _n);
+    return;
+  }
+
+  suspend_coordinate_transform(pls);
+  pls->line(_n, x_pl, y_pl);
+  resume_coordinate_transform(pls);
+}
+
+void PlotData2D::suspend_coordinate_transform(plstream *pls) {
+  if (draw_aux_data != nullptr && draw_aux_data->coordinate_transform != nullptr)
+    pls->stransform(NULL, NULL);
+}
+
+void PlotData2D::resume_coordinate_transform(plstream *pls) {
+  if (draw_aux_data != nullptr && draw_aux_data->coordinate_transform != nullptr)
+    pls->stransform(draw_aux_data->coordinate_transform, draw_aux_data->coordinate_transform_data);
+}
+
+//the default PLplot line styles, as set by plsty(), in micrometers: alternating marks and spaces
+static const std::vector<double> line_style_dashes[] = {
+  {},
+  {},
+  {1000, 1000},
+  {2000, 2000},
+  {2000, 1000},
+  {2500, 1000, 1000, 1000},
+  {2000, 2000, 1000, 1000},
+  {1000, 1000, 1500, 1500, 2000, 2000},
+  {1000, 1000, 1500, 1000, 2000, 1000},
+};
+
+//Liang-Barsky clipping of the segment from (x0, y0) to (x1, y1) against a rectangle.
+//Returns false if the segment lies completely outside of it, otherwise the endpoints are moved onto the rectangle if necessary
+static bool clip_segment(double &x0, double &y0, double &x1, double &y1,
+                         double xmin, double ymin, double xmax, double ymax) {
+  const double dx = x1 - x0;
+  const double dy = y1 - y0;
+  const double p[4] = {-dx, dx, -dy, dy};
+  const double q[4] = {x0 - xmin, xmax - x0, y0 - ymin, ymax - y0};
+  double t0 = 0.0, t1 = 1.0;
+
+  for (int i = 0 ; i < 4 ; i++) {
+    if (p[i] == 0.0) {
+      //parallel to this edge
+      if (q[i] < 0.0)
+        return false;
+      continue;
+    }
+    const double t = q[i] / p[i];
+    if (p[i] < 0.0) {
+      if (t > t1)
+        return false;
+      t0 = std::max(t0, t);
+    }
+    else {
+      if (t < t0)
+        return false;
+      t1 = std::min(t1, t);
+    }
+  }
+
+  if (t1 < 1.0) {
+    x1 = x0 + t1 * dx;
+    y1 = y0 + t1 * dy;
+  }
+  if (t0 > 0.0) {
+    x0 += t0 * dx;
+    y0 += t0 * dy;
+  }
+  return true;
+}
+
+void PlotData2D::stroke_line(const double *_x, const double *_y, size_t _n) {
+  if (_n < 2)
+    return;
+
+  const double *transform = draw_aux_data->plplot_to_plot_box;
+  const double *viewport = draw_aux_data->viewport_plot_box;
+
+  //Cairo uses fixed-point coordinates internally: the segments are clipped geometrically to a rectangle slightly larger than the viewport,
+  //which keeps the coordinates small while preserving the direction of the segments, and ensures the line caps remain outside of the viewport
+  const double margin = line_width + 1.0;
+  const double xmin = viewport[0] - margin;
+  const double ymin = viewport[1] - margin;
+  const double xmax = viewport[0] + viewport[2] + margin;
+  const double ymax = viewport[1] + viewport[3] + margin;
+
+  draw_context->save();
+  draw_context->set_matrix(draw_aux_data->plot_box_matrix);
+
+  //PLplot clips the data to the viewport
+  draw_context->rectangle(viewport[0], viewport[1], viewport[2], viewport[3]);
+  draw_context->clip();
+
+  //same appearance as the lines drawn by the extcairo driver, at its default resolution of 72 DPI
+  Gdk::Cairo::set_source_rgba(draw_context, color);
+  draw_context->set_line_width(line_width);
+  draw_context->set_line_join(Cairo::Context::LineJoin::BEVEL);
+  draw_context->set_line_cap(Cairo::Context::LineCap::ROUND);
+
+  std::vector<double> dashes(line_style_dashes[line_style]);
+  for (auto &dash : dashes)
+    dash *= 72.0 / 25400.0;
+  const bool dashed = !dashes.empty();
+
+  //Cairo restarts the dash pattern for every subpath, while PLplot continues it along the visible parts of the line:
+  //dashed lines are therefore stroked one visible run at a time, carrying over the dash offset
+  bool run_open = false;
+  double run_length = 0.0;
+  double dash_offset = 0.0;
+  double x_prev = 0.0, y_prev = 0.0;
+
+  auto end_run = [&]() {
+    if (!run_open)
+      return;
+    run_open = false;
+    if (!dashed)
+      return;
+    draw_context->set_dash(dashes, dash_offset);
+    draw_context->stroke();
+    dash_offset += run_length;
+  };
+
+  double x0 = transform[0] * _x[0] + transform[1];
+  double y0 = transform[2] * _y[0] + transform[3];
+
+  for (size_t i = 1 ; i < _n ; i++) {
+    const double x1 = transform[0] * _x[i] + transform[1];
+    const double y1 = transform[2] * _y[i] + transform[3];
+
+    double x0_clip = x0, y0_clip = y0, x1_clip = x1, y1_clip = y1;
+    if (!std::isfinite(x0) || !std::isfinite(y0) || !std::isfinite(x1) || !std::isfinite(y1) ||
+        !clip_segment(x0_clip, y0_clip, x1_clip, y1_clip, xmin, ymin, xmax, ymax)) {
+      end_run();
+    }
+    else {
+      //a segment that enters the rectangle starts a new run
+      if (run_open && (x0_clip != x_prev || y0_clip != y_prev))
+        end_run();
+      if (!run_open) {
+        draw_context->move_to(x0_clip, y0_clip);
+        run_open = true;
+        run_length = 0.0;
+      }
+      draw_context->line_to(x1_clip, y1_clip);
+      run_length += std::hypot(x1_clip - x0_clip, y1_clip - y0_clip);
+      x_prev = x1_clip;
+      y_prev = y1_clip;
+    }
+
+    x0 = x1;
+    y0 = y1;
+  }
+
+  end_run();
+
+  //solid lines are stroked at once
+  if (!dashed)
+    draw_context->stroke();
+
+  draw_context->restore();
+}
+
+void PlotData2D::plot_symbols(plstream *pls, const double *_x, const double *_y, size_t _n) {
+  const double *x_pl = get_plplot_x(_x, _n, plplot_x_buffer);
+  const double *y_pl = get_plplot_y(_y, _n, plplot_y_buffer);
+
+  if (symbol_sprites && stamp_symbols(pls, x_pl, y_pl, _n))
+    return;
+
+  suspend_coordinate_transform(pls);
+  pls->string(_n, x_pl, y_pl, symbol.c_str());
+  resume_coordinate_transform(pls);
+}
+
+void PlotData2D::update_symbol_sprite(double height, double scale) {
+  if (symbol_sprite && symbol_sprite_height == height && symbol_sprite_scale == scale)
+    return;
+
+  //the extcairo driver renders text with Pango at 72 DPI, using the default sans font
+  Pango::FontDescription font_description("sans");
+  font_description.set_absolute_size(height * 72.0 / 25.4 * PANGO_SCALE);
+
+  auto measure_cr = Cairo::Context::create(Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, 1, 1));
+  auto layout = Pango::Layout::create(measure_cr);
+  layout->set_font_description(font_description);
+  layout->set_text(symbol);
+  const Pango::Rectangle ink = layout->get_pixel_ink_extents();
+
+  //a pixel of padding on each side, to preserve the antialiasing
+  const double padding = 1.0;
+  symbol_sprite = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32,
+                                              std::ceil((ink.get_width() + 2 * padding) * scale),
+                                              std::ceil((ink.get_height() + 2 * padding) * scale));
+  symbol_sprite->set_device_scale(scale, scale);
+
+  auto sprite_cr = Cairo::Context::create(symbol_sprite);
+  Gdk::Cairo::set_source_rgba(sprite_cr, symbol_color);
+  sprite_cr->move_to(padding - ink.get_x(), padding - ink.get_y());
+  layout->update_from_cairo_context(sprite_cr);
+  layout->show_in_cairo_context(sprite_cr);
+  sprite_cr.reset();
+  symbol_sprite->flush();
+
+  //like PLplot, the symbols are centered on the datapoints
+  symbol_sprite_origin_x = padding + ink.get_width() / 2.0;
+  symbol_sprite_origin_y = padding + ink.get_height() / 2.0;
+  symbol_sprite_height = height;
+  symbol_sprite_scale = scale;
+}
+
+bool PlotData2D::stamp_symbols(plstream *pls, const double *_x, const double *_y, size_t _n) {
+  if (!draw_context || draw_aux_data == nullptr || !draw_aux_data->cairo_transform_valid ||
+      symbol.find('#') != Glib::ustring::npos)
+    return false;
+
+  //vector targets keep the symbols as glyphs. Recording surfaces are rasterized by Canvas afterwards,
+  //at the device scale they were given by Canvas or Plot::record_plot_cached()
+  auto target = draw_context->get_target();
+  if (target->get_type() != Cairo::Surface::Type::IMAGE && target->get_type() != Cairo::Surface::Type::RECORDING)
+    return false;
+
+  double scale, dummy;
+  target->get_device_scale(scale, dummy);
+
+  double default_height, height;
+  pls->gchr(default_height, height);
+  update_symbol_sprite(height, scale);
+
+  const double *transform = draw_aux_data->plplot_to_plot_box;
+  const double *viewport = draw_aux_data->viewport_plot_box;
+
+  draw_context->save();
+  draw_context->set_matrix(draw_aux_data->plot_box_matrix);
+
+  //PLplot clips the symbols to the viewport
+  draw_context->rectangle(viewport[0], viewport[1], viewport[2], viewport[3]);
+  draw_context->clip();
+
+  for (size_t i = 0 ; i < _n ; i++) {
+    const double x_box = transform[0] * _x[i] + transform[1];
+    const double y_box = transform[2] * _y[i] + transform[3];
+    if (!(x_box >= viewport[0] - symbol_sprite_origin_x && x_box <= viewport[0] + viewport[2] + symbol_sprite_origin_x &&
+          y_box >= viewport[1] - symbol_sprite_origin_y && y_box <= viewport[1] + viewport[3] + symbol_sprite_origin_y))
+      continue;
+
+    //snapping to the pixel grid allows Cairo to copy the sprite without resampling
+    const double left = std::round((x_box - symbol_sprite_origin_x) * scale) / scale;
+    const double top = std::round((y_box - symbol_sprite_origin_y) * scale) / scale;
+    draw_context->set_source(symbol_sprite, left, top);
+    draw_context->rectangle(left, top, symbol_sprite->get_width() / scale, symbol_sprite->get_height() / scale);
+    draw_context->fill();
+  }
+
+  draw_context->restore();
+
+  return true;
+}
+
+//counts the datapoints per cell: the cell column is floor(ax * x + bx), the cell row floor(ay * y + by)
+static void count_density_chunk(const double *x, const double *y, size_t n,
+                                double ax, double bx, double ay, double by,
+                                size_t columns, size_t rows, uint32_t *counts) {
+  for (size_t i = 0 ; i < n ; i++) {
+    const double column = std::floor(ax * x[i] + bx);
+    const double row = std::floor(ay * y[i] + by);
+    //also rejects NaN
+    if (!(column >= 0.0 && column < columns && row >= 0.0 && row < rows))
+      continue;
+    counts[static_cast<size_t>(row) * columns + static_cast<size_t>(column)]++;
+  }
+}
+
+void PlotData2D::update_density_map(double scale) {
+  const double *transform = draw_aux_data->plplot_to_plot_box;
+  const double *viewport = draw_aux_data->viewport_plot_box;
+
+  std::vector<double> key{transform[0], transform[1], transform[2], transform[3],
+                          viewport[0], viewport[1], viewport[2], viewport[3], scale};
+  if (density_map && density_map_key == key)
+    return;
+
+  const double cell = density_cell_size / scale;
+  const size_t columns = static_cast<size_t>(std::max(std::ceil(viewport[2] / cell), 1.0));
+  const size_t rows = static_cast<size_t>(std::max(std::ceil(viewport[3] / cell), 1.0));
+
+  //gather strided storage, then convert to PLplot coordinates
+  const DataView view_x = get_storage_view_x();
+  const DataView view_y = get_storage_view_y();
+  const size_t n = view_x.size;
+  std::vector<double> x_gathered, y_gathered;
+  const double *x_world = view_x.data, *y_world = view_y.data;
+  if (!view_x.is_contiguous()) {
+    x_gathered.resize(n);
+    for (size_t i = 0 ; i < n ; i++)
+      x_gathered[i] = view_x[i];
+    x_world = x_gathered.data();
+  }
+  if (!view_y.is_contiguous()) {
+    y_gathered.resize(n);
+    for (size_t i = 0 ; i < n ; i++)
+      y_gathered[i] = view_y[i];
+    y_world = y_gathered.data();
+  }
+  const double *x_pl = get_plplot_x(x_world, n, plplot_x_buffer);
+  const double *y_pl = get_plplot_y(y_world, n, plplot_y_buffer);
+
+  const double ax = transform[0] / cell;
+  const double bx = (transform[1] - viewport[0]) / cell;
+  const double ay = transform[2] / cell;
+  const double by = (transform[3] - viewport[1]) / cell;
+
+  //only split the data if each thread gets a chunk that is large enough to be worth it
+  const size_t min_chunk_size = 1 << 18;
+  const size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  const size_t n_threads = std::min(hardware_threads, std::max(n / min_chunk_size, size_t(1)));
+  const size_t chunk_size = (n + n_threads - 1) / n_threads;
+
+  //each thread fills its own partial grid, avoiding any contention
+  std::vector<uint32_t> counts(columns * rows, 0);
+  std::vector<std::vector<uint32_t>> partial_counts(n_threads - 1, std::vector<uint32_t>(columns * rows, 0));
+  std::vector<std::thread> threads;
+
+  for (size_t i = 1 ; i < n_threads ; i++) {
+    const size_t first = i * chunk_size;
+    const size_t chunk_n = std::min(chunk_size, n - first);
+    threads.emplace_back(count_density_chunk, x_pl + first, y_pl + first, chunk_n,
+                         ax, bx, ay, by, columns, rows, partial_counts[i - 1].data());
+  }
+
+  //the first chunk is counted directly into counts by the calling thread
+  count_density_chunk(x_pl, y_pl, std::min(chunk_size, n), ax, bx, ay, by, columns, rows, counts.data());
+
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &partial : partial_counts)
+    for (size_t i = 0 ; i < counts.size() ; i++)
+      counts[i] += partial[i];
+
+  if (density_palette.empty()) {
+    for (auto &color : get_colormap_colors(density_colormap)) {
+      const double alpha = color.get_alpha();
+      density_palette.push_back(static_cast<uint32_t>(std::lround(alpha * 255)) << 24 |
+                                static_cast<uint32_t>(std::lround(alpha * color.get_red() * 255)) << 16 |
+                                static_cast<uint32_t>(std::lround(alpha * color.get_green() * 255)) << 8 |
+                                static_cast<uint32_t>(std::lround(alpha * color.get_blue() * 255)));
+    }
+  }
+
+  //a logarithmic scale keeps sparse regions visible next to very dense ones
+  const uint32_t max_count = *std::max_element(counts.begin(), counts.end());
+  const double palette_scale = max_count == 0 ? 0.0 : (density_palette.size() - 1) / std::log1p(max_count);
+
+  density_map = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, columns, rows);
+  density_map->flush();
+  unsigned char *data = density_map->get_data();
+  const int stride = density_map->get_stride();
+
+  for (size_t row = 0 ; row < rows ; row++) {
+    uint32_t *pixels = reinterpret_cast<uint32_t *>(data + row * stride);
+    const uint32_t *row_counts = &counts[row * columns];
+    for (size_t column = 0 ; column < columns ; column++) {
+      const uint32_t count = row_counts[column];
+      pixels[column] = count == 0 ? 0 : density_palette[static_cast<size_t>(std::lround(std::log1p(count) * palette_scale))];
+    }
+  }
+
+  density_map->mark_dirty();
+  density_map_key = std::move(key);
+}
+
+void PlotData2D::draw_density_map(const Cairo::RefPtr<Cairo::Context> &cr) {
+  if (!is_showing() || size() == 0)
+    return;
+
+  double scale, dummy;
+  cr->get_target()->get_device_scale(scale, dummy);
+
+  update_density_map(scale);
+
+  const double *viewport = draw_aux_data->viewport_plot_box;
+  const double cell = density_cell_size / scale;
+
+  cr->save();
+  cr->set_matrix(draw_aux_data->plot_box_matrix);
+  cr->rectangle(viewport[0], viewport[1], viewport[2], viewport[3]);
+  cr->clip();
+
+  //each cell must remain a sharp block of color when the map is scaled up
+  cr->translate(viewport[0], viewport[1]);
+  cr->scale(cell, cell);
+  auto pattern = Cairo::SurfacePattern::create(density_map);
+  pattern->set_filter(Cairo::SurfacePattern::Filter::NEAREST);
+  cr->set_source(pattern);
+  cr->paint();
+
+  cr->restore();
+}
+
+void PlotData2D::draw_line_decimated(plstream *pls, const double *_x, const double *_y, size_t _n, double share) {
+  const size_t columns = draw_aux_data == nullptr ? 0 : static_cast<size_t>(std::ceil(draw_aux_data->viewport_width));
+
+  //decimation only pays off if there are considerably more datapoints than pixel columns
+  if (decimation_mode == NO_DECIMATION || columns == 0 || _n <= 4 * columns) {
+    plot_line(pls, _x, _y, _n);
+    return;
+  }
+
+  std::vector<double> x_dec, y_dec;
+
+  if (decimation_mode == MIN_MAX_ENVELOPE) {
+    x_dec.reserve(4 * columns + 8);
+    y_dec.reserve(4 * columns + 8);
+    decimate_min_max_envelope(_x, _y, _n, *draw_aux_data, columns, x_dec, y_dec);
+  }
+  else {
+    //two datapoints per pixel column covered by the datapoints, which have already been culled to the plotted window
+    const double threshold = std::max(2.0 * columns * share, 3.0);
+    if (threshold >= _n) {
+      plot_line(pls, _x, _y, _n);
+      return;
+    }
+    x_dec.reserve(static_cast<size_t>(threshold));
+    y_dec.reserve(static_cast<size_t>(threshold));
+    decimate_lttb(_x, _y, _n, *draw_aux_data, static_cast<size_t>(threshold), x_dec, y_dec);
+  }
+
+  plot_line(pls, x_dec.data(), y_dec.data(), x_dec.size());
+}
+
+void PlotData2D::invalidate_datapoint_caches() {
+  x_sorted_size = 0;
+  x_unsorted_position = 0;
+  incremental_valid = false;
+  plplot_x_cache_size = 0;
+  plplot_y_cache_size = 0;
+  evicted_size = 0;
+  invalidate_level_of_detail();
+}
+
+void PlotData2D::evict_datapoint_caches(size_t n) {
+  evicted_size += n;
+  incremental_valid = false;
+}
+
+void PlotData2D::compact_datapoint_caches() {
+  if (evicted_size == 0)
+    return;
+
+  x_sorted_size -= std::min(x_sorted_size, evicted_size);
+  x_unsorted_position -= std::min(x_unsorted_position, evicted_size);
+
+  for (auto cache : {std::make_pair(&plplot_x_cache, &plplot_x_cache_size), std::make_pair(&plplot_y_cache, &plplot_y_cache_size)}) {
+    if (*cache.second > evicted_size) {
+      cache.first->erase(cache.first->begin(), cache.first->begin() + evicted_size);
+      *cache.second -= evicted_size;
+    }
+    else {
+      *cache.second = 0;
+    }
+  }
+
+  //the blocks of the pyramid are no longer aligned with the positions of the datapoints
+  invalidate_level_of_detail();
+  evicted_size = 0;
+}
+
+void PlotData2D::invalidate_level_of_detail() {
+  lod_size = 0;
+  lod_min_index.clear();
+  lod_max_index.clear();
+}
+
+void PlotData2D::update_level_of_detail() {
+  const DataView view_y = get_storage_view_y();
+  const size_t n = evicted_size + view_y.size;
+
+  if (lod_size > n)
+    invalidate_level_of_detail();
+
+  if (lod_size == n)
+    return;
+
+  //the pyramid covers the positions of evicted datapoints as well, which are skipped:
+  //the blocks that contain them are never drawn
+  auto get_y = [&view_y, this](size_t position) {
+    return view_y[position - evicted_size];
+  };
+
+  //level 0 contains blocks of 4 datapoints, level 1 blocks of 4 level 0 blocks, etc.
+  //only the blocks that contain new datapoints need to be recalculated
+  size_t first_child = lod_size;
+  size_t children = n;
+
+  for (size_t level = 0 ; children > 1 ; level++) {
+    const size_t blocks = (children + 3) / 4;
+    const size_t first_block = first_child / 4;
+
+    if (level == lod_min_index.size()) {
+      lod_min_index.emplace_back();
+      lod_max_index.emplace_back();
+    }
+    lod_min_index[level].resize(blocks);
+    lod_max_index[level].resize(blocks);
+
+    for (size_t block = first_block ; block < blocks ; block++) {
+      const size_t child_end = std::min(4 * block + 4, children);
+      size_t imin = 0, imax = 0;
+      bool imin_found = false, imax_found = false;
+      for (size_t child = 4 * block ; child < child_end ; child++) {
+        const size_t child_min = level == 0 ? child : lod_min_index[level - 1][child];
+        const size_t child_max = level == 0 ? child : lod_max_index[level - 1][child];
+        if (child_min >= evicted_size && (!imin_found || get_y(child_min) < get_y(imin))) {
+          imin = child_min;
+          imin_found = true;
+        }
+        if (child_max >= evicted_size && (!imax_found || get_y(child_max) > get_y(imax))) {
+          imax = child_max;
+          imax_found = true;
+        }
+      }
+      lod_min_index[level][block] = imin;
+      lod_max_index[level][block] = imax;
+    }
+
+    first_child = first_block;
+    children = blocks;
+  }
+
+  lod_size = n;
+}
+
+//append the datapoints at the positions [lo, hi) using the coarsest blocks that fit completely within the range,
+//falling back to finer levels near the edges. The positions are offset by the number of evicted datapoints
+static void append_level_of_detail_range(const std::vector<std::vector<size_t>> &lod_min_index,
+                                         const std::vector<std::vector<size_t>> &lod_max_index,
+                                         const DataView &x, const DataView &y, size_t evicted_size,
+                                         int level, size_t block_size, size_t lo, size_t hi,
+                                         std::vector<double> &x_lod, std::vector<double> &y_lod) {
+  if (lo >= hi)
+    return;
+
+  if (level < 0) {
+    for (size_t i = lo ; i < hi ; i++) {
+      x_lod.push_back(x[i - evicted_size]);
+      y_lod.push_back(y[i - evicted_size]);
+    }
+    return;
+  }
+
+  const size_t first_block = (lo + block_size - 1) / block_size;
+  const size_t last_block = hi / block_size;
+
+  if (first_block >= last_block) {
+    append_level_of_detail_range(lod_min_index, lod_max_index, x, y, evicted_size, level - 1, block_size / 4, lo, hi, x_lod, y_lod);
+    return;
+  }
+
+  append_level_of_detail_range(lod_min_index, lod_max_index, x, y, evicted_size, level - 1, block_size / 4, lo, first_block * block_size, x_lod, y_lod);
+
+  for (size_t block = first_block ; block < last_block ; block++) {
+    const size_t imin = lod_min_index[level][block];
+    const size_t imax = lod_max_index[level][block];
+    x_lod.push_back(x[std::min(imin, imax) - evicted_size]);
+    y_lod.push_back(y[std::min(imin, imax) - evicted_size]);
+    if (imin != imax) {
+      x_lod.push_back(x[std::max(imin, imax) - evicted_size]);
+      y_lod.push_back(y[std::max(imin, imax) - evicted_size]);
+    }
+  }
+
+  append_level_of_detail_range(lod_min_index, lod_max_index, x, y, evicted_size, level - 1, block_size / 4, last_block * block_size, hi, x_lod, y_lod);
+}
+
+void PlotData2D::draw_line_level_of_detail(plstream *pls) {
+  const DataView view_x = get_storage_view_x();
+  const DataView view_y = get_storage_view_y();
+
+  //the visible datapoints
+  size_t lo, hi;
+  if (!get_visible_range(0, view_x.size, lo, hi) || hi - lo < 2)
+    return;
+
+  //pick the coarsest level that still provides at least one block per pixel column
+  const size_t columns = std::max<size_t>(1, static_cast<size_t>(std::ceil(draw_aux_data->viewport_width)));
+  int level = -1;
+  size_t block_size = 1;
+  while (level + 1 < static_cast<int>(lod_min_index.size()) && (hi - lo) / (block_size * 4) >= columns) {
+    level++;
+    block_size *= 4;
+  }
+
+  if (level < 0 && view_x.is_contiguous() && view_y.is_contiguous()) {
+    plot_line(pls, &view_x[lo], &view_y[lo], hi - lo);
+    return;
+  }
+
+  std::vector<double> x_lod, y_lod;
+  x_lod.reserve(8 * columns + 64);
+  y_lod.reserve(8 * columns + 64);
+  append_level_of_detail_range(lod_min_index, lod_max_index, view_x, view_y, evicted_size, level, block_size,
+                               evicted_size + lo, evicted_size + hi, x_lod, y_lod);
+
+  plot_line(pls, x_lod.data(), y_lod.data(), x_lod.size());
+}
+
+DataView PlotData2D::get_storage_view_x() {
+  return DataView(x.data(), x.size());
+}
+
+DataView PlotData2D::get_storage_view_y() {
+  return DataView(y.data(), y.size());
+}
+
+DataView PlotData2D::get_view_x() {
+  return get_storage_view_x();
+}
+
+DataView PlotData2D::get_view_y() {
+  return get_storage_view_y();
 }
 
 std::vector<double> PlotData2D::get_vector_x() {
@@ -151,17 +1199,74 @@ size_t PlotData2D::size() {
 }
 
 void PlotData2D::get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
-  if (x.empty()) {
+  if (size() == 0) {
     xmin = 0;
     xmax = 0;
     ymin = 0;
     ymax = 0;
-  } else {
-    xmin = *std::min_element(x.begin(), x.end());
-    xmax = *std::max_element(x.begin(), x.end());
-    ymin = *std::min_element(y.begin(), y.end());
-    ymax = *std::max_element(y.begin(), y.end());
+    return;
+  }
+
+  if (!extremes_valid) {
+    calculate_extremes(extremes_xmin, extremes_xmax, extremes_ymin, extremes_ymax);
+    extremes_valid = true;
   }
+
+  xmin = extremes_xmin;
+  xmax = extremes_xmax;
+  ymin = extremes_ymin;
+  ymax = extremes_ymax;
+}
+
+void PlotData2D::calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
+  auto x_minmax = std::minmax_element(x.begin(), x.end());
+  auto y_minmax = std::minmax_element(y.begin(), y.end());
+  xmin = *x_minmax.first;
+  xmax = *x_minmax.second;
+  ymin = *y_minmax.first;
+  ymax = *y_minmax.second;
+}
+
+void PlotData2D::get_datapoint_extremes(size_t _index, double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = xmax = x[_index];
+  ymin = ymax = y[_index];
+}
+
+void PlotData2D::extremes_add_datapoint(size_t _index) {
+  double xmin, xmax, ymin, ymax;
+
+  //the first datapoint of the dataset
+  if (_index == 0) {
+    get_datapoint_extremes(_index, extremes_xmin, extremes_xmax, extremes_ymin, extremes_ymax);
+    extremes_valid = true;
+    return;
+  }
+
+  //an invalid cache will be recalculated in full when required
+  if (!extremes_valid)
+    return;
+
+  get_datapoint_extremes(_index, xmin, xmax, ymin, ymax);
+  extremes_xmin = std::min(extremes_xmin, xmin);
+  extremes_xmax = std::max(extremes_xmax, xmax);
+  extremes_ymin = std::min(extremes_ymin, ymin);
+  extremes_ymax = std::max(extremes_ymax, ymax);
+}
+
+void PlotData2D::extremes_remove_datapoint(size_t _index) {
+  double xmin, xmax, ymin, ymax;
+
+  if (!extremes_valid)
+    return;
+
+  get_datapoint_extremes(_index, xmin, xmax, ymin, ymax);
+  if (xmin <= extremes_xmin || xmax >= extremes_xmax ||
+      ymin <= extremes_ymin || ymax >= extremes_ymax)
+    extremes_valid = false;
+}
+
+void PlotData2D::invalidate_extremes() {
+  extremes_valid = false;
 }
 
 void PlotData2D::replace_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
@@ -172,6 +1277,8 @@ void PlotData2D::replace_datapoints(const std::vector<double> &_x, const std::ve
   
   x.assign(_x.begin(), _x.end());
   y.assign(_y.begin(), _y.end());
+  invalidate_extremes();
+  invalidate_datapoint_caches();
 
   _signal_data_modified.emit();
 }
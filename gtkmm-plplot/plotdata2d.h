@@ -20,13 +20,44 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <vector>
 #include <valarray>
+#include <cstdint>
 #include <glibmm/ustring.h>
 #include <gtkmm-plplot/plotdataline.h>
+#include <gtkmm-plplot/dataview.h>
 #include <gdkmm/rgba.h>
 
 
 namespace Gtk {
   namespace PLplot {
+    /** \struct PlotData2DAuxData plotdata2d.h <gtkmm-plplot/plotdata2d.h>
+     *  \brief class for auxiliary data to the drawing routine draw_plot_data() used from Plot2D
+     *
+     */
+    struct PlotData2DAuxData {
+      double world_range_x[2]; ///< plot X-range, in world coordinates
+      double world_range_y[2]; ///< plot Y-range, in world coordinates
+      bool log10_x; ///< \c true if the X-axis is logarithmic
+      bool log10_y; ///< \c true if the Y-axis is logarithmic
+      double viewport_width; ///< the width of the plot viewport, in Cairo units
+      double viewport_height; ///< the height of the plot viewport, in Cairo units
+      bool cairo_transform_valid; ///< \c true if the plot provided the fields below, allowing datasets to draw onto the Cairo context directly
+      Cairo::Matrix plot_box_matrix; ///< maps the plot box, with its origin in the top left corner and in Cairo units, to the device space of the Cairo context the dataset is drawn to
+      double plplot_to_plot_box[4]; ///< affine transformation from PLplot coordinates to the plot box: <tt>[0] * x + [1]</tt> and <tt>[2] * y + [3]</tt>
+      double viewport_plot_box[4]; ///< the plot viewport in plot box coordinates: X, Y, width and height
+      void (*coordinate_transform)(double, double, double *, double *, void *); ///< the PLplot coordinate transform installed by the plot while drawing the datasets, \c nullptr if none
+      void *coordinate_transform_data; ///< the data passed to \c coordinate_transform
+      PlotData2DAuxData(double _world_range_x[2], double _world_range_y[2],
+                        bool _log10_x, bool _log10_y,
+                        double _viewport_width, double _viewport_height) :
+        world_range_x{_world_range_x[0], _world_range_x[1]},
+        world_range_y{_world_range_y[0], _world_range_y[1]},
+        log10_x(_log10_x), log10_y(_log10_y),
+        viewport_width(_viewport_width), viewport_height(_viewport_height),
+        cairo_transform_valid(false), plot_box_matrix(Cairo::identity_matrix()),
+        plplot_to_plot_box{1.0, 0.0, 1.0, 0.0}, viewport_plot_box{0.0, 0.0, 0.0, 0.0},
+        coordinate_transform(nullptr), coordinate_transform_data(nullptr) {}
+    };
+
     /** \class PlotData2D plotdata2d.h <gtkmm-plplot/plotdata2d.h>
      *  \brief a class that will hold a single dataset and its properties for a Plot2D plot
      *
@@ -50,6 +81,319 @@ namespace Gtk {
       Glib::ustring symbol; ///< If not an empty string, the symbol will be plotted at each of the data points from \c x and \c y.
       Gdk::RGBA symbol_color; ///< The color the symbol will be plotted in
       double symbol_scale_factor; ///< Scale factor that will determine the size of the symbols. Default is 1.
+      DecimationMode decimation_mode; ///< The decimation that will be applied to the line connecting the datapoints
+      const PlotData2DAuxData *draw_aux_data; ///< The auxiliary data of the plot that is currently drawing the dataset, \c nullptr if not available
+      bool lod_enabled; ///< Whether the level-of-detail pyramid will be used when drawing the line connecting the datapoints
+      size_t lod_size; ///< The number of positions currently covered by the level-of-detail pyramid, including those of evicted datapoints
+      std::vector<std::vector<size_t>> lod_min_index; ///< For each level of the pyramid, the position of the Y minimum within each block
+      std::vector<std::vector<size_t>> lod_max_index; ///< For each level of the pyramid, the position of the Y maximum within each block
+      size_t x_sorted_size; ///< The number of positions that have been checked for sortedness, including those of evicted datapoints
+      size_t x_unsorted_position; ///< The last position holding an X-value smaller than its predecessor, or 0 if none was found
+      size_t incremental_size; ///< The number of datapoints that were drawn by the last call to mark_rendered()
+      bool incremental_valid; ///< Whether the datapoints drawn before the last call to mark_rendered() are still unchanged, as are the properties of the dataset
+      bool incremental_shown; ///< Whether the dataset was showing at the time of the last call to mark_rendered()
+      std::vector<double> plplot_x_cache; ///< The base-10 logarithms of the X-values, used when drawing onto a logarithmic X-axis
+      std::vector<double> plplot_y_cache; ///< The base-10 logarithms of the Y-values, used when drawing onto a logarithmic Y-axis
+      size_t plplot_x_cache_size; ///< The number of positions currently covered by \c plplot_x_cache, including those of evicted datapoints
+      size_t plplot_y_cache_size; ///< The number of positions currently covered by \c plplot_y_cache, including those of evicted datapoints
+      size_t evicted_size; ///< The number of datapoints removed from the start of the storage since the caches were last invalidated or compacted. The caches index the datapoints by their position in the storage, offset by this number
+      std::vector<double> plplot_x_buffer; ///< Scratch buffer for X-values that are not part of the storage of the dataset
+      std::vector<double> plplot_y_buffer; ///< Scratch buffer for Y-values that are not part of the storage of the dataset
+      bool fast_line_rendering; ///< Whether the line connecting the datapoints is stroked directly with Cairo, instead of by PLplot
+      Cairo::RefPtr<Cairo::Context> draw_context; ///< The Cairo context the dataset is currently being drawn to by a Plot2D, \c nullptr if not available
+      bool symbol_sprites; ///< Whether the symbols are stamped from a prerendered image, instead of being drawn by PLplot
+      Cairo::RefPtr<Cairo::ImageSurface> symbol_sprite; ///< The prerendered symbol, \c nullptr if it needs to be rendered again
+      double symbol_sprite_height; ///< The character height in millimeters that \c symbol_sprite was rendered for
+      double symbol_sprite_scale; ///< The device scale that \c symbol_sprite was rendered for
+      double symbol_sprite_origin_x; ///< The horizontal position of the datapoint within \c symbol_sprite, in Cairo units
+      double symbol_sprite_origin_y; ///< The vertical position of the datapoint within \c symbol_sprite, in Cairo units
+      bool density_mode; ///< Whether the dataset is drawn as a point-density map, instead of a line and symbols
+      ColormapPalette density_colormap; ///< The colormap palette the point densities are mapped through
+      unsigned int density_cell_size; ///< The size of the cells of the point-density map, in device pixels
+      std::vector<uint32_t> density_palette; ///< \c density_colormap as premultiplied ARGB32 pixels, empty if it needs to be sampled again
+      Cairo::RefPtr<Cairo::ImageSurface> density_map; ///< The point-density map, \c nullptr if it needs to be calculated again
+      std::vector<double> density_map_key; ///< The plot box transformation, viewport and device scale \c density_map was calculated for
+      bool extremes_valid; ///< Whether the cached extremes are up to date with the dataset
+      double extremes_xmin; ///< Cached X minimum value
+      double extremes_xmax; ///< Cached X maximum value
+      double extremes_ymin; ///< Cached Y minimum value
+      double extremes_ymax; ///< Cached Y maximum value
+
+      /** Calculate the data extremes by scanning the complete dataset
+       *
+       * This method is called by get_extremes() whenever the cached extremes are no longer valid.
+       * It must only be called for a non-empty dataset.
+       * Inheriting classes whose extremes depend on more than \c x and \c y (errorbars for example) should override this method,
+       * as well as get_datapoint_extremes().
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax);
+
+      /** Get the extremes covered by a single datapoint
+       *
+       * \param index the position of the datapoint in the dataset
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void get_datapoint_extremes(size_t index, double &xmin, double &xmax, double &ymin, double &ymax);
+
+      /** Update the cached extremes after a datapoint was added to the dataset
+       *
+       * Must be called by all methods that append datapoints, after the datapoint was added.
+       * \param index the position of the new datapoint in the dataset
+       */
+      void extremes_add_datapoint(size_t index);
+
+      /** Update the cached extremes before a datapoint is removed from the dataset
+       *
+       * Must be called by all methods that remove datapoints, before the datapoint is actually removed.
+       * The cache is only invalidated if the datapoint defines one of the current extremes.
+       * \param index the position of the datapoint that is about to be removed
+       */
+      void extremes_remove_datapoint(size_t index);
+
+      /** Invalidate the cached extremes
+       *
+       * Must be called by all methods that modify the dataset in a way that is not covered by
+       * extremes_add_datapoint() or extremes_remove_datapoint().
+       * The extremes will be recalculated the next time get_extremes() is called.
+       */
+      void invalidate_extremes();
+
+      /** Draw a line connecting the datapoints, skipping those outside of the plotted window and applying the decimation mode if possible
+       *
+       * Should be used by all draw_plot_data() implementations instead of calling plstream::line() directly.
+       * Culling and decimation are only applied when the dataset is being drawn by a Plot2D.
+       * If the X-values are sorted, the visible datapoints are found using a binary search,
+       * otherwise a linear scan will drop all segments that are entirely outside the plotted window.
+       * \param pls the PLplot plstream object that will do the actual plotting
+       * \param x the X-values, in world coordinates
+       * \param y the Y-values, in world coordinates
+       * \param n the number of datapoints
+       */
+      void draw_line(plstream *pls, const double *x, const double *y, size_t n);
+
+      /** Draw a line connecting the datapoints, applying the decimation mode if possible
+       *
+       * \param pls the PLplot plstream object that will do the actual plotting
+       * \param x the X-values, in world coordinates
+       * \param y the Y-values, in world coordinates
+       * \param n the number of datapoints
+       * \param share the fraction of the plotted X-range covered by the datapoints, which determines how many of them are kept by LARGEST_TRIANGLE_THREE_BUCKETS
+       */
+      void draw_line_decimated(plstream *pls, const double *x, const double *y, size_t n, double share = 1.0);
+
+      /** Draw the plot symbol at the datapoints, skipping those outside of the plotted X-range if the X-values are sorted
+       *
+       * Should be used by all draw_plot_data() implementations instead of calling plstream::string() directly.
+       * \param pls the PLplot plstream object that will do the actual plotting
+       * \param x the X-values, in world coordinates
+       * \param y the Y-values, in world coordinates
+       * \param n the number of datapoints
+       */
+      void draw_symbols(plstream *pls, const double *x, const double *y, size_t n);
+
+      /** Convert X-values from world coordinates to PLplot coordinates
+       *
+       * When the dataset is being drawn by a Plot2D with a logarithmic X-axis, the base-10 logarithms of the values are returned.
+       * For values that are part of the contiguous storage of the dataset, these are taken from a cache that is only
+       * updated when datapoints are added or modified, otherwise they are calculated into \c buffer.
+       * In all other cases, \c x is returned as is.
+       * Together with suspend_coordinate_transform(), this avoids the PLplot coordinate transform of Plot2D, which is called for every single vertex.
+       * The converted values must only be passed to PLplot while the transform is suspended.
+       * \param x the X-values, in world coordinates
+       * \param n the number of X-values
+       * \param buffer storage for the converted values, if required
+       * \return the X-values, in PLplot coordinates. Valid until the dataset or \c buffer is modified
+       */
+      const double *get_plplot_x(const double *x, size_t n, std::vector<double> &buffer);
+
+      /** Convert Y-values from world coordinates to PLplot coordinates
+       *
+       * See get_plplot_x() for details.
+       * \param y the Y-values, in world coordinates
+       * \param n the number of Y-values
+       * \param buffer storage for the converted values, if required
+       * \return the Y-values, in PLplot coordinates. Valid until the dataset or \c buffer is modified
+       */
+      const double *get_plplot_y(const double *y, size_t n, std::vector<double> &buffer);
+
+      /** Uninstall the coordinate transform of the Plot2D that is drawing the dataset
+       *
+       * Must be called before passing coordinates obtained with get_plplot_x() and get_plplot_y() to PLplot,
+       * followed by resume_coordinate_transform() afterwards.
+       * The transform remains installed for all other PLplot calls, allowing inheriting classes to keep passing world coordinates to PLplot.
+       * \param pls the PLplot plstream object
+       */
+      void suspend_coordinate_transform(plstream *pls);
+
+      /** Reinstall the coordinate transform that was uninstalled by suspend_coordinate_transform()
+       *
+       * \param pls the PLplot plstream object
+       */
+      void resume_coordinate_transform(plstream *pls);
+
+      /** Draw a line connecting the datapoints, without culling or decimation
+       *
+       * Should be used instead of calling plstream::line() directly: the coordinates are converted with get_plplot_x() and get_plplot_y().
+       * \param pls the PLplot plstream object that will do the actual plotting
+       * \param x the X-values, in world coordinates
+       * \param y the Y-values, in world coordinates
+       * \param n the number of datapoints
+       */
+      void plot_line(plstream *pls, const double *x, const double *y, size_t n);
+
+      /** Draw the plot symbol at the datapoints, without culling
+       *
+       * Should be used instead of calling plstream::string() directly: the coordinates are converted with get_plplot_x() and get_plplot_y().
+       * \param pls the PLplot plstream object that will do the actual plotting
+       * \param x the X-values, in world coordinates
+       * \param y the Y-values, in world coordinates
+       * \param n the number of datapoints
+       */
+      void plot_symbols(plstream *pls, const double *x, const double *y, size_t n);
+
+      /** Stroke a line connecting the datapoints directly with Cairo
+       *
+       * Used by plot_line() if fast line rendering is enabled and the dataset is being drawn by a Plot2D.
+       * \param x the X-values, in PLplot coordinates
+       * \param y the Y-values, in PLplot coordinates
+       * \param n the number of datapoints
+       */
+      void stroke_line(const double *x, const double *y, size_t n);
+
+      /** Draw the plot symbol at the datapoints by stamping a prerendered image of it
+       *
+       * Used by plot_symbols() if symbol sprites are enabled and the dataset is being drawn by a Plot2D onto a raster target.
+       * \param pls the PLplot plstream object, providing the current character height
+       * \param x the X-values, in PLplot coordinates
+       * \param y the Y-values, in PLplot coordinates
+       * \param n the number of datapoints
+       * \return \c true if the symbols were drawn, \c false if they should be drawn by PLplot instead
+       */
+      bool stamp_symbols(plstream *pls, const double *x, const double *y, size_t n);
+
+      /** Render \c symbol_sprite, if it does not match the current symbol properties
+       *
+       * \param height the character height, in millimeters
+       * \param scale the device scale of the target
+       */
+      void update_symbol_sprite(double height, double scale);
+
+      /** Draw the dataset as a point-density map
+       *
+       * Used by draw_plot_data() if density mode is enabled and the dataset is being drawn by a Plot2D.
+       * \param cr the cairo context to draw to.
+       */
+      void draw_density_map(const Cairo::RefPtr<Cairo::Context> &cr);
+
+      /** Calculate \c density_map, if it does not match the current plot box transformation and viewport
+       *
+       * \param scale the device scale of the target
+       */
+      void update_density_map(double scale);
+
+      /** Check if the X-values are sorted in non-decreasing order
+       *
+       * The result is cached: after appending datapoints, only the new X-values are checked.
+       * \return \c true if sorted, \c false otherwise
+       */
+      bool is_x_sorted();
+
+      /** Get a view of the storage of the X-values
+       *
+       * All internal algorithms (sortedness, culling, level-of-detail) access the X-values through this method.
+       * Inheriting classes that do not store their datapoints in \c x should override it.
+       * \return a view of the X-values, in the order they are stored
+       */
+      virtual DataView get_storage_view_x();
+
+      /** Get a view of the storage of the Y-values
+       *
+       * All internal algorithms (culling, level-of-detail) access the Y-values through this method.
+       * Inheriting classes that do not store their datapoints in \c y should override it.
+       * \return a view of the Y-values, in the order they are stored
+       */
+      virtual DataView get_storage_view_y();
+
+      /** Find the datapoints within a range of the storage that fall within the plotted X-range using a binary search
+       *
+       * One datapoint on either side of the range is included, so that lines continue up to the edges of the plot.
+       * \param first the position in the storage of the first datapoint of the range
+       * \param n the number of datapoints in the range
+       * \param lo the position of the first datapoint of the slice, relative to \c first
+       * \param hi the position one past the last datapoint of the slice, relative to \c first
+       * \return \c true if the slice could be determined, \c false if the dataset is not being drawn by a Plot2D or the X-values are not sorted
+       */
+      bool get_visible_range(size_t first, size_t n, size_t &lo, size_t &hi);
+
+      /** Find the datapoints that fall within the plotted X-range using a binary search
+       *
+       * One datapoint on either side of the range is included, so that lines continue up to the edges of the plot.
+       * \param x the X-values, must be part of the contiguous storage returned by get_storage_view_x()
+       * \param n the number of datapoints
+       * \param lo the position of the first datapoint of the slice, relative to \c x
+       * \param hi the position one past the last datapoint of the slice, relative to \c x
+       * \return \c true if the slice could be determined, \c false if the dataset is not being drawn by a Plot2D or the X-values are not sorted
+       */
+      bool get_visible_slice(const double *x, size_t n, size_t &lo, size_t &hi);
+
+      /** Invalidate all caches that depend on the existing datapoints
+       *
+       * Must be called by all methods that modify or remove existing datapoints.
+       * Appending datapoints does not require invalidation: the caches will be extended the next time they are needed.
+       * Neither does removing the oldest datapoints, see evict_datapoint_caches().
+       */
+      void invalidate_datapoint_caches();
+
+      /** Keep the caches that depend on the existing datapoints valid after the oldest ones were removed
+       *
+       * To be called after the storage views returned by get_storage_view_x() and get_storage_view_y() have dropped their first \c n datapoints,
+       * while the remaining ones were left in place.
+       * The cache entries of the removed datapoints are kept until compact_datapoint_caches() is called, so this method runs in constant time.
+       * \param n the number of datapoints that were removed
+       */
+      void evict_datapoint_caches(size_t n);
+
+      /** Drop the cache entries of the datapoints that were removed with evict_datapoint_caches()
+       *
+       * To be called after the remaining datapoints have been moved to the start of the storage.
+       * The level-of-detail pyramid is recalculated the next time it is needed, all other caches remain valid.
+       */
+      void compact_datapoint_caches();
+
+      /** Check if the dataset supports incremental drawing with draw_plot_data_incremental()
+       *
+       * Inheriting classes whose draw_plot_data() method draws more than a line and symbols,
+       * or that may modify the existing datapoints when adding new ones, should override this method and return \c false.
+       * \return \c true if incremental drawing is supported, \c false otherwise
+       */
+      virtual bool is_incremental_drawing_supported();
+
+      /** Invalidate the level-of-detail pyramid
+       *
+       */
+      void invalidate_level_of_detail();
+
+      /** Bring the level-of-detail pyramid up to date with the dataset
+       *
+       * Only the datapoints that were added since the last update are processed.
+       */
+      void update_level_of_detail();
+
+      /** Draw a line connecting the datapoints, using the level-of-detail pyramid
+       *
+       * Only the datapoints within the currently plotted X-range are considered.
+       * The level of the pyramid is chosen to provide at least one block per pixel column.
+       * Requires update_level_of_detail() to be called first, and the X-values to be sorted (see is_x_sorted()).
+       * \param pls the PLplot plstream object that will do the actual plotting
+       */
+      void draw_line_level_of_detail(plstream *pls);
     public:
       /** Constructor
        *
@@ -121,24 +465,41 @@ namespace Gtk {
 
       /**
        *
-       * \returns a copy of the dataset X-values
+       * \returns a copy of the dataset X-values. Use get_view_x() to avoid the copy.
        */
-      std::vector<double> get_vector_x();
+      virtual std::vector<double> get_vector_x();
 
       /**
        *
-       * \returns a copy of the dataset Y-values
+       * \returns a copy of the dataset Y-values. Use get_view_y() to avoid the copy.
+       */
+      virtual std::vector<double> get_vector_y();
+
+      /** Get a read-only view of the dataset X-values, without copying them
+       *
+       * The view remains valid until the dataset is modified or destroyed.
+       * \returns a view of the dataset X-values
+       */
+      virtual DataView get_view_x();
+
+      /** Get a read-only view of the dataset Y-values, without copying them
+       *
+       * The view remains valid until the dataset is modified or destroyed.
+       * \returns a view of the dataset Y-values
        */
-      std::vector<double> get_vector_y();
+      virtual DataView get_view_y();
 
       /**
        *
        * \returns the number of elements in the dataset
        */
-      size_t size();
+      virtual size_t size();
 
       /** Get the data extremes: minima and maxima along both X- and Y-axes
        *
+       * The extremes are cached and updated incrementally when adding datapoints.
+       * A full scan of the dataset is only performed after the dataset was replaced,
+       * or after a datapoint that defined one of the extremes was removed.
        * \param xmin X minimum value
        * \param xmax X maximum value
        * \param ymin Y minimum value
@@ -194,6 +555,125 @@ namespace Gtk {
        */
       double get_symbol_height_scale_factor();
 
+      /** Set the decimation mode
+       *
+       * By default, all datapoints are passed to PLplot when drawing the line connecting them.
+       * For large datasets this can be very slow, while most of the segments end up in the same pixels anyway.
+       * Enabling decimation will reduce the number of datapoints of the line to a number that is proportional to the width of the plot,
+       * based on the currently plotted X-range of the Plot2D the dataset belongs to.
+       * Symbols and errorbars are never decimated.
+       * \param decimation_mode the new decimation mode
+       */
+      void set_decimation_mode(DecimationMode decimation_mode);
+
+      /** Get the decimation mode
+       *
+       * See set_decimation_mode() for more information
+       * \return the current decimation mode
+       */
+      DecimationMode get_decimation_mode();
+
+      /** Enable or disable the level-of-detail pyramid
+       *
+       * When enabled, a pyramid of Y minima and maxima is maintained over blocks of 4, 16, 64, ... consecutive datapoints,
+       * which is extended incrementally when datapoints are appended.
+       * It allows to draw any X-range with a cost that is proportional to the width of the plot, rather than to the number of datapoints in that range,
+       * which makes zooming in on very large datasets fast.
+       * The pyramid is only used if the X-values are sorted in non-decreasing order: for unsorted datasets, the line is drawn as usual.
+       * When enabled, it takes precedence over the decimation mode set with set_decimation_mode().
+       * Symbols and errorbars are not affected.
+       * \param enable \c true to enable the pyramid, \c false to disable it and release its memory
+       */
+      void set_level_of_detail(bool enable);
+
+      /** Check if the level-of-detail pyramid is enabled
+       *
+       * See set_level_of_detail() for more information
+       * \return \c true if enabled, \c false otherwise
+       */
+      bool get_level_of_detail();
+
+      /** Enable or disable fast line rendering
+       *
+       * When enabled and the dataset is drawn by a Plot2D, the line connecting the datapoints is not drawn by PLplot,
+       * but built as a single Cairo path that is stroked at once, after mapping the datapoints onto the plot box with a precomputed affine transformation.
+       * The result is visually equivalent, including the line styles, but considerably faster for large datasets.
+       * Culling, decimation and the level-of-detail pyramid are applied as usual. Symbols and errorbars are not affected.
+       * \param enable \c true to enable fast line rendering, \c false to let PLplot draw the line
+       */
+      void set_fast_line_rendering(bool enable);
+
+      /** Check if fast line rendering is enabled
+       *
+       * See set_fast_line_rendering() for more information
+       * \return \c true if enabled, \c false otherwise
+       */
+      bool get_fast_line_rendering();
+
+      /** Enable or disable symbol sprites
+       *
+       * When enabled and the dataset is drawn by a Plot2D, the symbol is rendered only once into a small image,
+       * taking into account the symbol color and height scale factor, which is then stamped at each of the datapoints.
+       * This is much faster than letting PLplot lay out the symbol as text at every datapoint, making it suitable for large scatter plots.
+       * When drawing onto vector targets, such as PDF and SVG surfaces, as well as for symbols containing PLplot escape sequences,
+       * the symbols are drawn by PLplot as usual.
+       * \param enable \c true to enable symbol sprites, \c false to let PLplot draw the symbols
+       */
+      void set_symbol_sprites(bool enable);
+
+      /** Check if symbol sprites are enabled
+       *
+       * See set_symbol_sprites() for more information
+       * \return \c true if enabled, \c false otherwise
+       */
+      bool get_symbol_sprites();
+
+      /** Enable or disable density mode
+       *
+       * When enabled and the dataset is drawn by a Plot2D, the line and symbols are replaced with a point-density map:
+       * the plotted window is divided into cells (see set_density_cell_size()), the datapoints falling within each cell are counted,
+       * and the counts are mapped onto the density colormap (see set_density_colormap()) using a logarithmic scale.
+       * Cells without datapoints are left transparent. The map is drawn as a single image, making this mode
+       * suited for scatter plots with millions of overlapping datapoints.
+       * Counting is spread over multiple threads for large datasets. The map is only recalculated when the dataset or
+       * the plotted window changes, for example after zooming in with a RegionSelection.
+       * Errorbars are not drawn in density mode.
+       * \param enable \c true to enable density mode, \c false to draw the line and symbols
+       */
+      void set_density_mode(bool enable);
+
+      /** Check if density mode is enabled
+       *
+       * See set_density_mode() for more information
+       * \return \c true if enabled, \c false otherwise
+       */
+      bool get_density_mode();
+
+      /** Set the colormap palette of the point-density map
+       *
+       * \param colormap the colormap palette, default is BLUE_YELLOW
+       */
+      void set_density_colormap(ColormapPalette colormap);
+
+      /** Get the colormap palette of the point-density map
+       *
+       * \return the colormap palette
+       */
+      ColormapPalette get_density_colormap();
+
+      /** Set the size of the cells of the point-density map
+       *
+       * \param cell_size the size of the cells in device pixels, must be strictly positive. Default is 1
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_density_cell_size(unsigned int cell_size);
+
+      /** Get the size of the cells of the point-density map
+       *
+       * \return the size of the cells in device pixels
+       */
+      unsigned int get_density_cell_size();
+
       /** Add a single datapoint, consisting of an \c xval and \c yval value, to the dataset
        *
        * This datapoint will be added at the end of the std::vector's \c x and \c y.
@@ -211,6 +691,48 @@ namespace Gtk {
        */
       virtual void add_datapoint(std::pair<double, double> xy_pair);
 
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x and \c y.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once,
+       * making this the preferred method to add large numbers of datapoints.
+       * This method assumes that \c x and \c y are vectors of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::vector<double>
+       * \param y The Y-values to be added, as std::vector<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x and \c y.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once,
+       * making this the preferred method to add large numbers of datapoints.
+       * This method assumes that \c x and \c y are valarrays of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::valarray<double>
+       * \param y The Y-values to be added, as std::valarray<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x and \c y.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once,
+       * making this the preferred method to add large numbers of datapoints.
+       * The data is copied from the arrays: they do not need to outlive this call.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, an array containing at least \c n elements
+       * \param y The Y-values to be added, an array containing at least \c n elements
+       * \param n The number of datapoints to be added
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const double *x, const double *y, size_t n);
+
       /** Removes a single datapoint from the dataset.
        *
        * The datapoint at position \c index will be removed from the dataset if \c index is valid.
@@ -250,6 +772,39 @@ namespace Gtk {
        * \param pls the PLplot plstream object that will do the actual plotting on the Cairo context
        */
       virtual void draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls) override;
+
+      /** Method to draw the dataset, taking into account the state of the Plot2D it belongs to
+       *
+       * This method makes \c aux_data available to draw_line(), after which draw_plot_data(cr, pls) is called.
+       * In density mode, the point-density map is drawn instead.
+       * \param cr the cairo context to draw to.
+       * \param pls the PLplot plstream object that will do the actual plotting on the Cairo context
+       * \param aux_data auxiliary data provided by the Plot2D
+       */
+      void draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls, const PlotData2DAuxData &aux_data);
+
+      /** Method to draw only the datapoints that were appended since the last call to mark_rendered()
+       *
+       * The line segment connecting the previously drawn datapoints with the new ones is drawn as well.
+       * Used by Plot2D in incremental rendering mode, to draw on top of its previous rendering of the dataset.
+       * Must only be called if can_draw_incrementally() returns \c true.
+       * \param cr the cairo context to draw to.
+       * \param pls the PLplot plstream object that will do the actual plotting on the Cairo context
+       * \param aux_data auxiliary data provided by the Plot2D
+       */
+      void draw_plot_data_incremental(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls, const PlotData2DAuxData &aux_data);
+
+      /** Check if the dataset can be drawn using draw_plot_data_incremental()
+       *
+       * \return \c true if only datapoints were appended since the last call to mark_rendered(), \c false if the dataset must be drawn completely
+       */
+      bool can_draw_incrementally();
+
+      /** Record that the dataset has been drawn completely
+       *
+       * Used by Plot2D in incremental rendering mode.
+       */
+      void mark_rendered();
     };
   }
 }
@@ -91,18 +91,21 @@ std::vector<double> PlotData2DErrorX::get_vector_error_x_high() {
   return errorx_high;
 }
 
-void PlotData2DErrorX::get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
-  if (x.empty()) {
-    xmin = 0;
-    xmax = 0;
-    ymin = 0;
-    ymax = 0;
-  } else {
-    xmin = *std::min_element(errorx_low.begin(), errorx_low.end());
-    xmax = *std::max_element(errorx_high.begin(), errorx_high.end());
-    ymin = *std::min_element(y.begin(), y.end());
-    ymax = *std::max_element(y.begin(), y.end());
-  }
+void PlotData2DErrorX::calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = *std::min_element(errorx_low.begin(), errorx_low.end());
+  xmax = *std::max_element(errorx_high.begin(), errorx_high.end());
+  ymin = *std::min_element(y.begin(), y.end());
+  ymax = *std::max_element(y.begin(), y.end());
+}
+
+void PlotData2DErrorX::get_datapoint_extremes(size_t _index, double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = errorx_low[_index];
+  xmax = errorx_high[_index];
+  ymin = ymax = y[_index];
+}
+
+bool PlotData2DErrorX::is_incremental_drawing_supported() {
+  return false;
 }
 
 void PlotData2DErrorX::set_error_x_color(Gdk::RGBA _errorx_color) {
@@ -127,6 +130,63 @@ void PlotData2DErrorX::add_datapoint(double xval, double yval, double xval_error
   y.push_back(yval);
   errorx_low.push_back(xval_error_low);
   errorx_high.push_back(xval_error_high);
+  extremes_add_datapoint(x.size() - 1);
+  _signal_data_modified.emit();
+}
+
+void PlotData2DErrorX::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> This method is not supported for PlotData2DErrorX");
+}
+
+void PlotData2DErrorX::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> This method is not supported for PlotData2DErrorX");
+}
+
+void PlotData2DErrorX::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> This method is not supported for PlotData2DErrorX");
+}
+
+void PlotData2DErrorX::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y, const std::vector<double> &_errorx_low, const std::vector<double> &_errorx_high) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _errorx_low.size() || _x.size() != _errorx_high.size()) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> data arrays x, y, errorx_low and errorx_high must have the same size!");
+  }
+  append_datapoints(_x.data(), _y.data(), _errorx_low.data(), _errorx_high.data(), _x.size());
+}
+
+void PlotData2DErrorX::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y, const std::valarray<double> &_errorx_low, const std::valarray<double> &_errorx_high) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _errorx_low.size() || _x.size() != _errorx_high.size()) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> data arrays x, y, errorx_low and errorx_high must have the same size!");
+  }
+  append_datapoints(std::begin(_x), std::begin(_y), std::begin(_errorx_low), std::begin(_errorx_high), _x.size());
+}
+
+void PlotData2DErrorX::append_datapoints(const double *_x, const double *_y, const double *_errorx_low, const double *_errorx_high, size_t _n) {
+  if (_n == 0)
+    return;
+
+  if (_x == nullptr || _y == nullptr || _errorx_low == nullptr || _errorx_high == nullptr) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> data arrays x, y, errorx_low and errorx_high cannot be NULL!");
+  }
+
+  //ensure that the errorx_low values are less than x and the errorx_high values greater than x
+  for (size_t i = 0 ; i < _n ; i++) {
+    if (_errorx_low[i] > _x[i])
+      throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> errorx_low elements must be less than the corresponding elements in x");
+    else if (_errorx_high[i] < _x[i])
+      throw Exception("Gtk::PLplot::PlotData2DErrorX::append_datapoints -> errorx_high elements must be greater than the corresponding elements in x");
+  }
+
+  size_t first = x.size();
+  x.insert(x.end(), _x, _x + _n);
+  y.insert(y.end(), _y, _y + _n);
+  errorx_low.insert(errorx_low.end(), _errorx_low, _errorx_low + _n);
+  errorx_high.insert(errorx_high.end(), _errorx_high, _errorx_high + _n);
+
+  for (size_t i = first ; i < x.size() ; i++)
+    extremes_add_datapoint(i);
+
   _signal_data_modified.emit();
 }
 
@@ -134,6 +194,8 @@ void PlotData2DErrorX::remove_datapoint(size_t _index) {
   if (_index >= x.size()) {
     throw Exception("Gtk::PLplot::PlotData2DErrorX::remove_datapoint -> invalid index!");
   }
+  extremes_remove_datapoint(_index);
+  invalidate_datapoint_caches();
   x.erase(x.begin() + _index);
   y.erase(y.begin() + _index);
   errorx_low.erase(errorx_low.begin() + _index);
@@ -154,19 +216,24 @@ void PlotData2DErrorX::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, p
     change_plstream_color(pls, color);
     pls->lsty(line_style);
     pls->width(line_width);
-    pls->line(x.size(), x_pl, y_pl);
+    draw_line(pls, x_pl, y_pl, x.size());
   }
 
   // plot the x errorbars
   change_plstream_color(pls, errorx_color);
   // need to see what happens with the errorbars when changing the line_width and line_style
-  pls->errx(x.size(), errorx_low_pl, errorx_high_pl, y_pl);
+  std::vector<double> errorx_high_buffer;
+  suspend_coordinate_transform(pls);
+  pls->errx(x.size(), get_plplot_x(errorx_low_pl, x.size(), plplot_x_buffer),
+            get_plplot_x(errorx_high_pl, x.size(), errorx_high_buffer),
+            get_plplot_y(y_pl, y.size(), plplot_y_buffer));
+  resume_coordinate_transform(pls);
 
   // plot the symbols if requested
   if (!symbol.empty()) {
     change_plstream_color(pls, symbol_color);
     pls->schr(0, symbol_scale_factor);
-    pls->string(x.size(), x_pl, y_pl, symbol.c_str());
+    draw_symbols(pls, x_pl, y_pl, x.size());
   }
 }
 
@@ -187,6 +254,8 @@ void PlotData2DErrorX::replace_datapoints(const std::vector<double> &_x, const s
   y.assign(_y.begin(), _y.end());
   errorx_low.assign(_errorx_low.begin(), _errorx_low.end());
   errorx_high.assign(_errorx_high.begin(), _errorx_high.end());
+  invalidate_extremes();
+  invalidate_datapoint_caches();
 
   _signal_data_modified.emit();
 }
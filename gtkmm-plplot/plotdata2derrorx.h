@@ -44,10 +44,38 @@ namespace Gtk {
       virtual void add_datapoint(std::pair<double, double> xy_pair) override; ///< disable this method
       virtual void replace_datapoints(const std::vector<double> &x, const std::vector<double> &y) override; ///< disable this method
       virtual void replace_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) override; ///< disable this method
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y) override; ///< disable this method
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) override; ///< disable this method
+      virtual void append_datapoints(const double *x, const double *y, size_t n) override; ///< disable this method
     protected:
       std::vector<double> errorx_low; ///< The lower error margins of the X-data
       std::vector<double> errorx_high; ///< The upper error margins of the X-data
       Gdk::RGBA errorx_color; ///< The color of the X-data errorbars
+
+      /** Calculate the data extremes by scanning the complete dataset, taking the errorbars into account
+       *
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) override;
+
+      /** Get the extremes covered by a single datapoint, taking its errorbars into account
+       *
+       * \param index the position of the datapoint in the dataset
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void get_datapoint_extremes(size_t index, double &xmin, double &xmax, double &ymin, double &ymax) override;
+
+      /** Check if the dataset supports incremental drawing
+       *
+       * \return \c false, since the errorbars are not drawn incrementally
+       */
+      virtual bool is_incremental_drawing_supported() override;
     public:
       /** Constructor
        *
@@ -113,15 +141,6 @@ namespace Gtk {
        */
       std::vector<double> get_vector_error_x_high();
 
-      /** Get the data extremes: minima and maxima along both X- and Y-axes
-       *
-       * \param xmin X minimum value
-       * \param xmax X maximum value
-       * \param ymin Y minimum value
-       * \param ymax Y minimum value
-       */
-      virtual void get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) override;
-
       /** Set the X-dataset errorbar color
        *
        * \param color the color that will used for plotting the X-data errorbar.
@@ -145,6 +164,51 @@ namespace Gtk {
        */
       virtual void add_datapoint(double xval, double yval, double xval_error_low, double xval_error_high);
 
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y, \c errorx_low and \c errorx_high.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * This method assumes that \c x, \c y, \c errorx_low and \c errorx_high are vectors of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::vector<double>
+       * \param y The Y-values to be added, as std::vector<double>
+       * \param errorx_low The lower values of the X-data errorbars to be added, as std::vector<double>
+       * \param errorx_high The upper values of the X-data errorbars to be added, as std::vector<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &errorx_low, const std::vector<double> &errorx_high);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y, \c errorx_low and \c errorx_high.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * This method assumes that \c x, \c y, \c errorx_low and \c errorx_high are valarrays of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::valarray<double>
+       * \param y The Y-values to be added, as std::valarray<double>
+       * \param errorx_low The lower values of the X-data errorbars to be added, as std::valarray<double>
+       * \param errorx_high The upper values of the X-data errorbars to be added, as std::valarray<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y, const std::valarray<double> &errorx_low, const std::valarray<double> &errorx_high);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y, \c errorx_low and \c errorx_high.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * The data is copied from the arrays: they do not need to outlive this call.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, an array containing at least \c n elements
+       * \param y The Y-values to be added, an array containing at least \c n elements
+       * \param errorx_low The lower values of the X-data errorbars to be added, an array containing at least \c n elements
+       * \param errorx_high The upper values of the X-data errorbars to be added, an array containing at least \c n elements
+       * \param n The number of datapoints to be added
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const double *x, const double *y, const double *errorx_low, const double *errorx_high, size_t n);
+
       /** Removes a single datapoint from the dataset.
        *
        * The datapoint at position \c index will be removed from the dataset if \c index is valid.
@@ -91,18 +91,21 @@ std::vector<double> PlotData2DErrorY::get_vector_error_y_high() {
   return errory_high;
 }
 
-void PlotData2DErrorY::get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
-  if (x.empty()) {
-    xmin = 0;
-    xmax = 0;
-    ymin = 0;
-    ymax = 0;
-  } else {
-    xmin = *std::min_element(x.begin(), x.end());
-    xmax = *std::max_element(x.begin(), x.end());
-    ymin = *std::min_element(errory_low.begin(), errory_low.end());
-    ymax = *std::max_element(errory_high.begin(), errory_high.end());
-  }
+void PlotData2DErrorY::calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = *std::min_element(x.begin(), x.end());
+  xmax = *std::max_element(x.begin(), x.end());
+  ymin = *std::min_element(errory_low.begin(), errory_low.end());
+  ymax = *std::max_element(errory_high.begin(), errory_high.end());
+}
+
+void PlotData2DErrorY::get_datapoint_extremes(size_t _index, double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = xmax = x[_index];
+  ymin = errory_low[_index];
+  ymax = errory_high[_index];
+}
+
+bool PlotData2DErrorY::is_incremental_drawing_supported() {
+  return false;
 }
 
 void PlotData2DErrorY::set_error_y_color(Gdk::RGBA _errory_color) {
@@ -127,6 +130,63 @@ void PlotData2DErrorY::add_datapoint(double xval, double yval, double yval_error
   y.push_back(yval);
   errory_low.push_back(yval_error_low);
   errory_high.push_back(yval_error_high);
+  extremes_add_datapoint(x.size() - 1);
+  _signal_data_modified.emit();
+}
+
+void PlotData2DErrorY::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> This method is not supported for PlotData2DErrorY");
+}
+
+void PlotData2DErrorY::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> This method is not supported for PlotData2DErrorY");
+}
+
+void PlotData2DErrorY::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> This method is not supported for PlotData2DErrorY");
+}
+
+void PlotData2DErrorY::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y, const std::vector<double> &_errory_low, const std::vector<double> &_errory_high) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _errory_low.size() || _x.size() != _errory_high.size()) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> data arrays x, y, errory_low and errory_high must have the same size!");
+  }
+  append_datapoints(_x.data(), _y.data(), _errory_low.data(), _errory_high.data(), _x.size());
+}
+
+void PlotData2DErrorY::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y, const std::valarray<double> &_errory_low, const std::valarray<double> &_errory_high) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _errory_low.size() || _x.size() != _errory_high.size()) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> data arrays x, y, errory_low and errory_high must have the same size!");
+  }
+  append_datapoints(std::begin(_x), std::begin(_y), std::begin(_errory_low), std::begin(_errory_high), _x.size());
+}
+
+void PlotData2DErrorY::append_datapoints(const double *_x, const double *_y, const double *_errory_low, const double *_errory_high, size_t _n) {
+  if (_n == 0)
+    return;
+
+  if (_x == nullptr || _y == nullptr || _errory_low == nullptr || _errory_high == nullptr) {
+    throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> data arrays x, y, errory_low and errory_high cannot be NULL!");
+  }
+
+  //ensure that the errory_low values are less than y and the errory_high values greater than y
+  for (size_t i = 0 ; i < _n ; i++) {
+    if (_errory_low[i] > _y[i])
+      throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> errory_low elements must be less than the corresponding elements in y");
+    else if (_errory_high[i] < _y[i])
+      throw Exception("Gtk::PLplot::PlotData2DErrorY::append_datapoints -> errory_high elements must be greater than the corresponding elements in y");
+  }
+
+  size_t first = x.size();
+  x.insert(x.end(), _x, _x + _n);
+  y.insert(y.end(), _y, _y + _n);
+  errory_low.insert(errory_low.end(), _errory_low, _errory_low + _n);
+  errory_high.insert(errory_high.end(), _errory_high, _errory_high + _n);
+
+  for (size_t i = first ; i < x.size() ; i++)
+    extremes_add_datapoint(i);
+
   _signal_data_modified.emit();
 }
 
@@ -134,6 +194,8 @@ void PlotData2DErrorY::remove_datapoint(size_t _index) {
   if (_index >= x.size()) {
     throw Exception("Gtk::PLplot::PlotData2DErrorY::remove_datapoint -> invalid index!");
   }
+  extremes_remove_datapoint(_index);
+  invalidate_datapoint_caches();
   x.erase(x.begin() + _index);
   y.erase(y.begin() + _index);
   errory_low.erase(errory_low.begin() + _index);
@@ -154,19 +216,24 @@ void PlotData2DErrorY::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, p
     change_plstream_color(pls, color);
     pls->lsty(line_style);
     pls->width(line_width);
-    pls->line(x.size(), x_pl, y_pl);
+    draw_line(pls, x_pl, y_pl, x.size());
   }
 
   // plot the y errorbars
   change_plstream_color(pls, errory_color);
   // need to see what happens with the errorbars when changing the line_width and line_style
-  pls->erry(x.size(), x_pl, errory_low_pl, errory_high_pl);
+  std::vector<double> errory_high_buffer;
+  suspend_coordinate_transform(pls);
+  pls->erry(x.size(), get_plplot_x(x_pl, x.size(), plplot_x_buffer),
+            get_plplot_y(errory_low_pl, y.size(), plplot_y_buffer),
+            get_plplot_y(errory_high_pl, y.size(), errory_high_buffer));
+  resume_coordinate_transform(pls);
 
   // plot the symbols if requested
   if (!symbol.empty()) {
     change_plstream_color(pls, symbol_color);
     pls->schr(0, symbol_scale_factor);
-    pls->string(x.size(), x_pl, y_pl, symbol.c_str());
+    draw_symbols(pls, x_pl, y_pl, x.size());
   }
 }
 
@@ -187,6 +254,8 @@ void PlotData2DErrorY::replace_datapoints(const std::vector<double> &_x, const s
   y.assign(_y.begin(), _y.end());
   errory_low.assign(_errory_low.begin(), _errory_low.end());
   errory_high.assign(_errory_high.begin(), _errory_high.end());
+  invalidate_extremes();
+  invalidate_datapoint_caches();
 
   _signal_data_modified.emit();
 }
@@ -0,0 +1,210 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/plotdata2dqueue.h>
+#include <gtkmm-plplot/exception.h>
+
+using namespace Gtk::PLplot;
+
+static size_t round_up_to_power_of_two(size_t n) {
+  size_t rv = 1;
+  while (rv < n)
+    rv <<= 1;
+  return rv;
+}
+
+PlotData2DQueue::PlotData2DQueue(
+  PlotData2D &_data,
+  size_t _capacity,
+  bool _multiple_producers) :
+  data(_data),
+  multiple_producers(_multiple_producers),
+  capacity(round_up_to_power_of_two(_capacity)),
+  enqueue_position(0),
+  dequeue_position(0),
+  widget(nullptr),
+  tick_callback_id(0),
+  awake(true) {
+
+  if (_capacity == 0) {
+    throw Exception("Gtk::PLplot::PlotData2DQueue::PlotData2DQueue -> capacity must be strictly positive");
+  }
+
+  cells.reset(new Cell[capacity]);
+  for (size_t i = 0 ; i < capacity ; i++)
+    cells[i].sequence.store(i, std::memory_order_relaxed);
+
+  x_drained.reserve(capacity);
+  y_drained.reserve(capacity);
+
+  dispatcher.connect(sigc::mem_fun(*this, &PlotData2DQueue::on_dispatch));
+}
+
+PlotData2DQueue::~PlotData2DQueue() {
+  detach();
+}
+
+bool PlotData2DQueue::claim(size_t n, size_t &position) {
+  position = enqueue_position.load(std::memory_order_relaxed);
+
+  while (true) {
+    //cells are released by the consumer in order: if the last one is writable, so are all others
+    const size_t last = position + n - 1;
+    const size_t sequence = cells[last & (capacity - 1)].sequence.load(std::memory_order_acquire);
+    const ptrdiff_t diff = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(last);
+
+    if (diff < 0)
+      return false;
+
+    if (diff == 0) {
+      if (!multiple_producers) {
+        enqueue_position.store(position + n, std::memory_order_relaxed);
+        return true;
+      }
+      if (enqueue_position.compare_exchange_weak(position, position + n, std::memory_order_relaxed))
+        return true;
+    }
+    else {
+      //another producer claimed these cells in the meantime
+      position = enqueue_position.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool PlotData2DQueue::push(double _x, double _y) {
+  size_t position;
+  if (!claim(1, position))
+    return false;
+
+  Cell &cell = cells[position & (capacity - 1)];
+  cell.x = _x;
+  cell.y = _y;
+  cell.sequence.store(position + 1, std::memory_order_release);
+  wake_up();
+
+  return true;
+}
+
+bool PlotData2DQueue::push(const double *_x, const double *_y, size_t _n) {
+  if (_n == 0)
+    return true;
+
+  if (_x == nullptr || _y == nullptr || _n > capacity)
+    return false;
+
+  size_t position;
+  if (!claim(_n, position))
+    return false;
+
+  for (size_t i = 0 ; i < _n ; i++) {
+    Cell &cell = cells[(position + i) & (capacity - 1)];
+    cell.x = _x[i];
+    cell.y = _y[i];
+    cell.sequence.store(position + i + 1, std::memory_order_release);
+  }
+  wake_up();
+
+  return true;
+}
+
+size_t PlotData2DQueue::drain() {
+  x_drained.clear();
+  y_drained.clear();
+
+  //at most one queue's worth of datapoints, to keep up with producers that push continuously
+  for (size_t i = 0 ; i < capacity ; i++) {
+    Cell &cell = cells[dequeue_position & (capacity - 1)];
+    //stop at the first cell that has not been published yet
+    if (cell.sequence.load(std::memory_order_acquire) != dequeue_position + 1)
+      break;
+
+    x_drained.push_back(cell.x);
+    y_drained.push_back(cell.y);
+    cell.sequence.store(dequeue_position + capacity, std::memory_order_release);
+    dequeue_position++;
+  }
+
+  if (!x_drained.empty())
+    data.append_datapoints(x_drained.data(), y_drained.data(), x_drained.size());
+
+  return x_drained.size();
+}
+
+void PlotData2DQueue::wake_up() {
+  //pairs with the fence in on_frame_tick(): either the main thread drains the datapoints that were just published,
+  //or this thread sees that the tick callback was removed
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (!awake.load(std::memory_order_relaxed) && !awake.exchange(true, std::memory_order_relaxed))
+    dispatcher.emit();
+}
+
+void PlotData2DQueue::attach(Gtk::Widget &_widget) {
+  detach();
+
+  widget = &_widget;
+  widget->add_destroy_notify_callback(this, &PlotData2DQueue::on_widget_destroyed);
+  awake.store(true, std::memory_order_relaxed);
+  tick_callback_id = widget->add_tick_callback(sigc::mem_fun(*this, &PlotData2DQueue::on_frame_tick));
+}
+
+void PlotData2DQueue::detach() {
+  if (widget != nullptr) {
+    if (tick_callback_id != 0)
+      widget->remove_tick_callback(tick_callback_id);
+    widget->remove_destroy_notify_callback(this);
+  }
+
+  widget = nullptr;
+  tick_callback_id = 0;
+  //without a widget, there is nothing to wake up
+  awake.store(true, std::memory_order_relaxed);
+}
+
+bool PlotData2DQueue::on_frame_tick(const Glib::RefPtr<Gdk::FrameClock> &frame_clock) {
+  if (drain() > 0)
+    return true;
+
+  //no datapoints arrived during the last frame: stop ticking, so the frame clock can go idle
+  awake.store(false, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  //a producer may have published datapoints without seeing the store above
+  if (drain() > 0) {
+    awake.store(true, std::memory_order_relaxed);
+    return true;
+  }
+
+  tick_callback_id = 0;
+  return false;
+}
+
+void PlotData2DQueue::on_dispatch() {
+  if (widget != nullptr && tick_callback_id == 0)
+    tick_callback_id = widget->add_tick_callback(sigc::mem_fun(*this, &PlotData2DQueue::on_frame_tick));
+}
+
+void PlotData2DQueue::on_widget_destroyed(sigc::notifiable *data) {
+  //the tick callback is removed together with the widget
+  auto queue = static_cast<PlotData2DQueue *>(data);
+  queue->widget = nullptr;
+  queue->tick_callback_id = 0;
+  queue->awake.store(true, std::memory_order_relaxed);
+}
+
+size_t PlotData2DQueue::get_capacity() const {
+  return capacity;
+}
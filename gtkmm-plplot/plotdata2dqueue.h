@@ -0,0 +1,172 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_PLOTDATA_2D_QUEUE_H
+#define GTKMMPLPLOT_PLOTDATA_2D_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <gtkmm/widget.h>
+#include <glibmm/dispatcher.h>
+#include <gtkmm-plplot/plotdata2d.h>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \class PlotData2DQueue plotdata2dqueue.h <gtkmm-plplot/plotdata2dqueue.h>
+     *  \brief a lock-free queue that transfers datapoints from producer threads to a PlotData2D dataset
+     *
+     *  PlotData2D datasets, like all other gtkmm-plplot classes, may only be used on the thread that runs the GTK main loop.
+     *  This class allows other threads, such as data acquisition threads, to push datapoints without taking any locks,
+     *  into a bounded buffer that is drained on the main thread into the dataset, using a single call to PlotData2D::append_datapoints().
+     *  After calling attach(), this happens automatically once per frame of the widget, typically the Canvas that shows the dataset,
+     *  for as long as datapoints keep arriving: the dataset, and therefore the canvas, is only updated when datapoints were drained.
+     *  Once a frame passes without new datapoints, the queue stops listening to the frame clock, allowing it to go idle,
+     *  until the next push wakes up the main thread through a Glib::Dispatcher. Only that push makes a system call.
+     *  The queue supports either a single producer thread, or multiple producer threads at a slightly higher cost per push.
+     *  In both cases, only the main thread may drain the queue.
+     *  The dataset must outlive the queue, and the producer threads must have stopped pushing before the queue is destroyed.
+     *  The attached widget may be destroyed before the queue: it will be detached automatically.
+     */
+    class PlotData2DQueue : public sigc::trackable {
+    private:
+      PlotData2DQueue() = delete; ///< no default constructor
+      PlotData2DQueue(const PlotData2DQueue &) = delete; ///< no copy constructor
+      PlotData2DQueue &operator=(const PlotData2DQueue &) = delete; ///< no assignment operator
+
+      /** \struct Cell
+       *  \brief a slot of the ring buffer
+       */
+      struct Cell {
+        std::atomic<size_t> sequence; ///< the position in the queue that this cell is ready for: equal to it when writable, one more when readable
+        double x; ///< the X-value of the datapoint
+        double y; ///< the Y-value of the datapoint
+      };
+
+      PlotData2D &data; ///< the dataset that the queue is drained into
+      const bool multiple_producers; ///< \c true if several threads may push concurrently
+      const size_t capacity; ///< the number of cells, a power of two
+      std::unique_ptr<Cell[]> cells; ///< the ring buffer
+      alignas(64) std::atomic<size_t> enqueue_position; ///< the position of the next cell to be claimed by a producer
+      alignas(64) size_t dequeue_position; ///< the position of the next cell to be read by the main thread
+      std::vector<double> x_drained; ///< staging buffer for the X-values, reused by every drain()
+      std::vector<double> y_drained; ///< staging buffer for the Y-values, reused by every drain()
+      Gtk::Widget *widget; ///< the widget whose frame clock triggers drain(), or nullptr
+      guint tick_callback_id; ///< the id of the tick callback installed on \c widget, or 0 if none is installed
+      alignas(64) std::atomic<bool> awake; ///< \c false if the tick callback was removed because the queue ran empty, and no producer has woken up the main thread since
+      Glib::Dispatcher dispatcher; ///< wakes up the main thread when a datapoint is pushed while the queue is not \c awake
+
+      /** Claim \c n consecutive cells for a producer
+       *
+       * \param n the number of cells, at most \c capacity
+       * \param position the position of the first claimed cell
+       * \return \c true if the cells were claimed, \c false if the queue does not have enough free cells
+       */
+      bool claim(size_t n, size_t &position);
+
+      /** Wake up the main thread if the tick callback was removed, called by the producers after publishing their datapoints
+       *
+       */
+      void wake_up();
+
+      /** Tick callback that drains the queue once per frame
+       *
+       * \param frame_clock the frame clock of \c widget
+       * \return \c true to keep the callback installed, \c false if no datapoints were drained
+       */
+      bool on_frame_tick(const Glib::RefPtr<Gdk::FrameClock> &frame_clock);
+
+      /** Installs the tick callback again when a producer woke up the main thread
+       *
+       */
+      void on_dispatch();
+
+      /** Detaches the queue when the attached widget is destroyed
+       *
+       * \param data the queue
+       */
+      static void on_widget_destroyed(sigc::notifiable *data);
+    public:
+      /** Constructor
+       *
+       * Must be called on the main thread.
+       * \param data the dataset that the queue will be drained into
+       * \param capacity the minimum number of datapoints the queue can hold, rounded up to the next power of two. Must be strictly positive
+       * \param multiple_producers \c true if several threads will push datapoints concurrently, \c false if only a single thread will
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotData2DQueue(PlotData2D &data, size_t capacity, bool multiple_producers = false);
+
+      /** Destructor
+       *
+       * Detaches the queue, if necessary. Datapoints that were not drained yet are discarded.
+       */
+      virtual ~PlotData2DQueue();
+
+      /** Push a single datapoint
+       *
+       * This method is lock-free and may be called from any producer thread.
+       * \param x an X-value
+       * \param y an Y-value
+       * \return \c true if the datapoint was queued, \c false if the queue is full
+       */
+      bool push(double x, double y);
+
+      /** Push a block of datapoints
+       *
+       * This method is lock-free and may be called from any producer thread.
+       * The block is queued as a whole or not at all: blocks pushed by different producers are never interleaved.
+       * \param x The X-values, an array containing at least \c n elements
+       * \param y The Y-values, an array containing at least \c n elements
+       * \param n The number of datapoints, at most the capacity of the queue
+       * \return \c true if the datapoints were queued, \c false if the queue does not have enough room for them
+       */
+      bool push(const double *x, const double *y, size_t n);
+
+      /** Move all queued datapoints into the dataset
+       *
+       * \c signal_data_modified() of the dataset is emitted at most once.
+       * Must be called on the main thread.
+       * \return the number of datapoints that were added to the dataset
+       */
+      size_t drain();
+
+      /** Drain the queue automatically, once per frame of \c widget, while datapoints keep arriving
+       *
+       * Any widget that was attached before will be detached first.
+       * If \c widget is destroyed, the queue is detached automatically.
+       * Must be called on the main thread.
+       * \param widget the widget, usually the Canvas containing the dataset
+       */
+      void attach(Gtk::Widget &widget);
+
+      /** Stop draining the queue automatically
+       *
+       * Must be called on the main thread.
+       */
+      void detach();
+
+      /** Get the capacity of the queue
+       *
+       * \return the maximum number of datapoints the queue can hold
+       */
+      size_t get_capacity() const;
+    };
+  }
+}
+
+#endif
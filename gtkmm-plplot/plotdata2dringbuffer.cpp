@@ -0,0 +1,236 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/plotdata2dringbuffer.h>
+#include <gtkmm-plplot/exception.h>
+#include <gtkmm-plplot/utils.h>
+#include <plstream.h>
+
+using namespace Gtk::PLplot;
+
+PlotData2DRingBuffer::PlotData2DRingBuffer(
+  size_t _capacity,
+  Gdk::RGBA _color,
+  LineStyle _line_style,
+  double _line_width) :
+  Glib::ObjectBase("GtkmmPLplotPlotData2DRingBuffer"),
+  PlotData2D(std::vector<double>(), std::vector<double>(), _color, _line_style, _line_width),
+  capacity(_capacity), head(0), first_sequence(0) {
+
+  if (capacity == 0) {
+    throw Exception("Gtk::PLplot::PlotData2DRingBuffer::PlotData2DRingBuffer -> capacity must be strictly positive");
+  }
+  x.reserve(2 * capacity);
+  y.reserve(2 * capacity);
+}
+
+PlotData2DRingBuffer::~PlotData2DRingBuffer() {}
+
+size_t PlotData2DRingBuffer::get_position(size_t _sequence) {
+  return head + (_sequence - first_sequence);
+}
+
+void PlotData2DRingBuffer::push_datapoint(double _x, double _y) {
+  if (size() == capacity) {
+    //evict the oldest datapoint from the queues
+    for (auto queue : {&xmin_queue, &xmax_queue, &ymin_queue, &ymax_queue}) {
+      if (!queue->empty() && queue->front() == first_sequence)
+        queue->pop_front();
+    }
+    //the remaining datapoints stay in place, and so do their cache entries
+    head++;
+    first_sequence++;
+    evict_datapoint_caches(1);
+  }
+
+  //move the window back to the start of the storage once its end is reached
+  if (x.size() == 2 * capacity) {
+    x.erase(x.begin(), x.begin() + head);
+    y.erase(y.begin(), y.begin() + head);
+    head = 0;
+    compact_datapoint_caches();
+  }
+
+  x.push_back(_x);
+  y.push_back(_y);
+
+  const size_t sequence = first_sequence + size() - 1;
+
+  //candidates at the back of a queue can be dropped as soon as a newer datapoint beats them:
+  //they will be evicted before the newer one and can therefore never become the extreme again
+  while (!xmin_queue.empty() && x[get_position(xmin_queue.back())] >= _x)
+    xmin_queue.pop_back();
+  xmin_queue.push_back(sequence);
+
+  while (!xmax_queue.empty() && x[get_position(xmax_queue.back())] <= _x)
+    xmax_queue.pop_back();
+  xmax_queue.push_back(sequence);
+
+  while (!ymin_queue.empty() && y[get_position(ymin_queue.back())] >= _y)
+    ymin_queue.pop_back();
+  ymin_queue.push_back(sequence);
+
+  while (!ymax_queue.empty() && y[get_position(ymax_queue.back())] <= _y)
+    ymax_queue.pop_back();
+  ymax_queue.push_back(sequence);
+}
+
+void PlotData2DRingBuffer::reset_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  x.clear();
+  y.clear();
+  head = 0;
+  first_sequence = 0;
+  xmin_queue.clear();
+  xmax_queue.clear();
+  ymin_queue.clear();
+  ymax_queue.clear();
+  invalidate_datapoint_caches();
+
+  //only the most recent datapoints will fit
+  const size_t first = _x.size() > capacity ? _x.size() - capacity : 0;
+  for (size_t i = first ; i < _x.size() ; i++)
+    push_datapoint(_x[i], _y[i]);
+}
+
+bool PlotData2DRingBuffer::is_incremental_drawing_supported() {
+  return false;
+}
+
+void PlotData2DRingBuffer::set_capacity(size_t _capacity) {
+  if (_capacity == capacity)
+    return;
+
+  if (_capacity == 0) {
+    throw Exception("Gtk::PLplot::PlotData2DRingBuffer::set_capacity -> capacity must be strictly positive");
+  }
+
+  std::vector<double> x_linear = get_vector_x();
+  std::vector<double> y_linear = get_vector_y();
+
+  capacity = _capacity;
+  x.shrink_to_fit();
+  y.shrink_to_fit();
+  x.reserve(2 * capacity);
+  y.reserve(2 * capacity);
+  reset_datapoints(x_linear, y_linear);
+
+  _signal_data_modified.emit();
+}
+
+size_t PlotData2DRingBuffer::get_capacity() {
+  return capacity;
+}
+
+DataView PlotData2DRingBuffer::get_storage_view_x() {
+  return DataView(x.data() + head, x.size() - head);
+}
+
+DataView PlotData2DRingBuffer::get_storage_view_y() {
+  return DataView(y.data() + head, y.size() - head);
+}
+
+std::vector<double> PlotData2DRingBuffer::get_vector_x() {
+  return std::vector<double>(x.begin() + head, x.end());
+}
+
+std::vector<double> PlotData2DRingBuffer::get_vector_y() {
+  return std::vector<double>(y.begin() + head, y.end());
+}
+
+size_t PlotData2DRingBuffer::size() {
+  return x.size() - head;
+}
+
+void PlotData2DRingBuffer::get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
+  if (size() == 0) {
+    xmin = 0;
+    xmax = 0;
+    ymin = 0;
+    ymax = 0;
+  } else {
+    xmin = x[get_position(xmin_queue.front())];
+    xmax = x[get_position(xmax_queue.front())];
+    ymin = y[get_position(ymin_queue.front())];
+    ymax = y[get_position(ymax_queue.front())];
+  }
+}
+
+void PlotData2DRingBuffer::add_datapoint(double _x, double _y) {
+  push_datapoint(_x, _y);
+  _signal_data_modified.emit();
+}
+
+void PlotData2DRingBuffer::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  if (_n == 0)
+    return;
+
+  if (_x == nullptr || _y == nullptr) {
+    throw Exception("Gtk::PLplot::PlotData2DRingBuffer::append_datapoints -> data arrays x and y cannot be NULL!");
+  }
+
+  //datapoints that would be evicted immediately are skipped
+  const size_t first = _n > capacity ? _n - capacity : 0;
+  for (size_t i = first ; i < _n ; i++)
+    push_datapoint(_x[i], _y[i]);
+
+  _signal_data_modified.emit();
+}
+
+void PlotData2DRingBuffer::remove_datapoint(size_t _index) {
+  if (_index >= size()) {
+    throw Exception("Gtk::PLplot::PlotData2DRingBuffer::remove_datapoint -> invalid index!");
+  }
+
+  std::vector<double> x_linear = get_vector_x();
+  std::vector<double> y_linear = get_vector_y();
+  x_linear.erase(x_linear.begin() + _index);
+  y_linear.erase(y_linear.begin() + _index);
+  reset_datapoints(x_linear, y_linear);
+
+  _signal_data_modified.emit();
+}
+
+void PlotData2DRingBuffer::replace_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+   //ensure both arrays have the same size
+  if (_x.size() != _y.size()) {
+    throw Exception("Gtk::PLplot::PlotData2DRingBuffer::replace_datapoints -> data arrays x and y must have the same size!");
+  }
+
+  reset_datapoints(_x, _y);
+
+  _signal_data_modified.emit();
+}
+
+void PlotData2DRingBuffer::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls) {
+  if (!is_showing() || size() == 0)
+    return;
+
+  // plot the line if requested
+  if (line_style != LineStyle::NONE) {
+    change_plstream_color(pls, color);
+    pls->lsty(line_style);
+    pls->width(line_width);
+    draw_line(pls, &x[head], &y[head], size());
+  }
+
+  // plot the symbols if requested
+  if (!symbol.empty()) {
+    change_plstream_color(pls, symbol_color);
+    pls->schr(0, symbol_scale_factor);
+    draw_symbols(pls, &x[head], &y[head], size());
+  }
+}
@@ -0,0 +1,220 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_PLOTDATA_2D_RINGBUFFER_H
+#define GTKMMPLPLOT_PLOTDATA_2D_RINGBUFFER_H
+
+#include <deque>
+#include <gtkmm-plplot/plotdata2d.h>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \class PlotData2DRingBuffer plotdata2dringbuffer.h <gtkmm-plplot/plotdata2dringbuffer.h>
+     *  \brief a class that will hold a fixed-capacity dataset for scrolling Plot2D plots
+     *
+     *  Instances of this class contain a single dataset for a Plot2D two-dimensional plot,
+     *  that can hold at most a fixed number of datapoints, determined by its capacity.
+     *  Once the dataset is full, adding a new datapoint will evict the oldest one, in constant time.
+     *  This makes this class ideally suited for strip charts that only show the most recent datapoints.
+     *  Internally, the datapoints are kept in chronological order in a window that slides over \c x and \c y,
+     *  which can hold twice the capacity: evicting a datapoint only moves the start of the window, and once the end of
+     *  the vectors is reached, the window is moved back to their start, which happens once every \c capacity datapoints.
+     *  The dataset therefore always occupies contiguous storage, allowing get_view_x() and get_view_y() to run in constant time,
+     *  and the caches of PlotData2D (logarithms, sortedness, level-of-detail) to remain valid when datapoints are evicted.
+     *  The extremes of the dataset are tracked using monotonic queues, ensuring that
+     *  get_extremes() does not require a scan of the dataset after an eviction.
+     *  Important is that whenever a property is changed, \c signal_changed() is emitted, which will eventually
+     *  be picked up by the \c canvas that will hold the plot.
+     */
+    class PlotData2DRingBuffer : public PlotData2D {
+    private:
+      PlotData2DRingBuffer() = delete; ///< no default constructor
+      PlotData2DRingBuffer &operator=(const PlotData2DRingBuffer &) = delete; ///< no assignment operator
+      PlotData2DRingBuffer(const PlotData2DRingBuffer &source) = delete; ///< no default copy constructor;
+    protected:
+      size_t capacity; ///< The maximum number of datapoints in the dataset
+      size_t head; ///< The position of the oldest datapoint in \c x and \c y: the dataset occupies the positions from \c head up to their end
+      size_t first_sequence; ///< The sequence number of the oldest datapoint
+      std::deque<size_t> xmin_queue; ///< Monotonic queue with the sequence numbers of the X minimum candidates
+      std::deque<size_t> xmax_queue; ///< Monotonic queue with the sequence numbers of the X maximum candidates
+      std::deque<size_t> ymin_queue; ///< Monotonic queue with the sequence numbers of the Y minimum candidates
+      std::deque<size_t> ymax_queue; ///< Monotonic queue with the sequence numbers of the Y maximum candidates
+
+      /** Get the position in \c x and \c y of a datapoint
+       *
+       * \param sequence the sequence number of the datapoint
+       * \return the position of the datapoint in \c x and \c y
+       */
+      size_t get_position(size_t sequence);
+
+      /** Add a datapoint at the end of the ring buffer, evicting the oldest datapoint if the buffer is full
+       *
+       * Does not emit \c signal_data_modified().
+       * \param xval an X-value
+       * \param yval an Y-value
+       */
+      void push_datapoint(double xval, double yval);
+
+      /** Replace the contents of the ring buffer with the most recent datapoints of \c x and \c y
+       *
+       * Does not emit \c signal_data_modified().
+       * \param x the X-values, in chronological order
+       * \param y the Y-values, in chronological order
+       */
+      void reset_datapoints(const std::vector<double> &x, const std::vector<double> &y);
+
+      /** Check if the dataset supports incremental drawing
+       *
+       * \return \c false, since adding datapoints may evict the oldest ones
+       */
+      virtual bool is_incremental_drawing_supported() override;
+
+      /** Get a view of the storage of the X-values
+       *
+       * \return a view of the X-values, in chronological order
+       */
+      virtual DataView get_storage_view_x() override;
+
+      /** Get a view of the storage of the Y-values
+       *
+       * \return a view of the Y-values, in chronological order
+       */
+      virtual DataView get_storage_view_y() override;
+    public:
+      /** Constructor
+       *
+       * This constructor initializes a new, empty dataset that will hold at most \c capacity datapoints.
+       * Optionally, one can also use the constructor to override the default color, line style and line width.
+       * \param capacity the maximum number of datapoints, must be strictly positive
+       * \param color the line color, default is red
+       * \param line_style the line style, default is CONTINUOUS
+       * \param line_width the line width, default is 1.0
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotData2DRingBuffer(size_t capacity,
+                           Gdk::RGBA color = Gdk::RGBA("red"),
+                           LineStyle line_style = CONTINUOUS,
+                           double line_width = PLOTDATA_DEFAULT_LINE_WIDTH);
+
+      /** Destructor
+       *
+       */
+      virtual ~PlotData2DRingBuffer();
+
+      using PlotData2D::add_datapoint;
+      using PlotData2D::append_datapoints;
+      using PlotData2D::replace_datapoints;
+
+      /** Set the capacity of the dataset
+       *
+       * If the dataset currently holds more than \c capacity datapoints, the oldest ones will be removed.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param capacity the maximum number of datapoints, must be strictly positive
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_capacity(size_t capacity);
+
+      /** Get the capacity of the dataset
+       *
+       * \return the maximum number of datapoints
+       */
+      size_t get_capacity();
+
+      /**
+       *
+       * \returns a copy of the dataset X-values, in chronological order
+       */
+      virtual std::vector<double> get_vector_x() override;
+
+      /**
+       *
+       * \returns a copy of the dataset Y-values, in chronological order
+       */
+      virtual std::vector<double> get_vector_y() override;
+
+      /**
+       *
+       * \returns the number of elements in the dataset
+       */
+      virtual size_t size() override;
+
+      /** Get the data extremes: minima and maxima along both X- and Y-axes
+       *
+       * This method runs in constant time.
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void get_extremes(double &xmin, double &xmax, double &ymin, double &ymax) override;
+
+      /** Add a single datapoint, consisting of an \c xval and \c yval value, to the dataset
+       *
+       * If the dataset is full, the oldest datapoint will be removed.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param xval an X-value
+       * \param yval an Y-value
+       */
+      virtual void add_datapoint(double xval, double yval) override;
+
+      /** Append a block of datapoints to the dataset
+       *
+       * If the dataset overflows, the oldest datapoints will be removed.
+       * \c signal_data_modified() will be emitted only once.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, an array containing at least \c n elements
+       * \param y The Y-values to be added, an array containing at least \c n elements
+       * \param n The number of datapoints to be added
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const double *x, const double *y, size_t n) override;
+
+      /** Removes a single datapoint from the dataset.
+       *
+       * The datapoint at position \c index, counting from the oldest datapoint, will be removed from the dataset if \c index is valid.
+       * An exception will be thrown otherwise.
+       * Contrary to add_datapoint(), this method requires linear time.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param index The current position of the datapoint in the dataset.
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void remove_datapoint(size_t index) override;
+
+      /** Replaces all datapoints in the dataset with the new vectors
+       *
+       * This method assumes that \c x and \c y are vectors of equal length.
+       * An exception will be thrown otherwise.
+       * If these vectors contain more elements than the capacity of the dataset, only the last ones will be retained.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The new X-values, as std::vector<double>
+       * \param y The new Y-values, as std::vector<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void replace_datapoints(const std::vector<double> &x, const std::vector<double> &y) override;
+
+      /** Method to draw the dataset
+       *
+       * The datapoints are drawn as a single line, straight from the storage of the ring buffer.
+       * \param cr the cairo context to draw to.
+       * \param pls the PLplot plstream object that will do the actual plotting on the Cairo context
+       */
+      virtual void draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls) override;
+    };
+  }
+}
+
+#endif
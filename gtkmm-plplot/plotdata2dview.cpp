@@ -0,0 +1,203 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/plotdata2dview.h>
+#include <gtkmm-plplot/exception.h>
+#include <gtkmm-plplot/utils.h>
+#include <plstream.h>
+#include <algorithm>
+
+using namespace Gtk::PLplot;
+
+PlotData2DView::PlotData2DView(
+  const double *_x,
+  const double *_y,
+  size_t _n,
+  size_t _stride_x,
+  size_t _stride_y,
+  Gdk::RGBA _color,
+  LineStyle _line_style,
+  double _line_width) :
+  Glib::ObjectBase("GtkmmPLplotPlotData2DView"),
+  PlotData2D(std::vector<double>(), std::vector<double>(), _color, _line_style, _line_width) {
+
+  if (_n > 0 && (_x == nullptr || _y == nullptr)) {
+    throw Exception("Gtk::PLplot::PlotData2DView::PlotData2DView -> data arrays x and y cannot be NULL!");
+  }
+  if (_stride_x == 0 || _stride_y == 0) {
+    throw Exception("Gtk::PLplot::PlotData2DView::PlotData2DView -> strides must be strictly positive");
+  }
+  view_x = DataView(_x, _n, _stride_x);
+  view_y = DataView(_y, _n, _stride_y);
+}
+
+PlotData2DView::~PlotData2DView() {}
+
+void PlotData2DView::add_datapoint(double _x, double _y) {
+  throw Exception("Gtk::PLplot::PlotData2DView::add_datapoint -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::add_datapoint(std::pair<double, double> _xy_pair) {
+  throw Exception("Gtk::PLplot::PlotData2DView::add_datapoint -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DView::append_datapoints -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DView::append_datapoints -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  throw Exception("Gtk::PLplot::PlotData2DView::append_datapoints -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::remove_datapoint(size_t _index) {
+  throw Exception("Gtk::PLplot::PlotData2DView::remove_datapoint -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::replace_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DView::replace_datapoints -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::replace_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData2DView::replace_datapoints -> This method is not supported for PlotData2DView");
+}
+
+void PlotData2DView::set_view(const double *_x, const double *_y, size_t _n, size_t _stride_x, size_t _stride_y) {
+  if (_n > 0 && (_x == nullptr || _y == nullptr)) {
+    throw Exception("Gtk::PLplot::PlotData2DView::set_view -> data arrays x and y cannot be NULL!");
+  }
+  if (_stride_x == 0 || _stride_y == 0) {
+    throw Exception("Gtk::PLplot::PlotData2DView::set_view -> strides must be strictly positive");
+  }
+  view_x = DataView(_x, _n, _stride_x);
+  view_y = DataView(_y, _n, _stride_y);
+
+  notify_data_modified();
+}
+
+void PlotData2DView::notify_data_modified() {
+  invalidate_extremes();
+  invalidate_datapoint_caches();
+  _signal_data_modified.emit();
+}
+
+DataView PlotData2DView::get_storage_view_x() {
+  return view_x;
+}
+
+DataView PlotData2DView::get_storage_view_y() {
+  return view_y;
+}
+
+std::vector<double> PlotData2DView::get_vector_x() {
+  std::vector<double> rv(view_x.size);
+  for (size_t i = 0 ; i < view_x.size ; i++)
+    rv[i] = view_x[i];
+  return rv;
+}
+
+std::vector<double> PlotData2DView::get_vector_y() {
+  std::vector<double> rv(view_y.size);
+  for (size_t i = 0 ; i < view_y.size ; i++)
+    rv[i] = view_y[i];
+  return rv;
+}
+
+size_t PlotData2DView::size() {
+  return view_x.size;
+}
+
+void PlotData2DView::calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = xmax = view_x[0];
+  ymin = ymax = view_y[0];
+  for (size_t i = 1 ; i < view_x.size ; i++) {
+    xmin = std::min(xmin, view_x[i]);
+    xmax = std::max(xmax, view_x[i]);
+    ymin = std::min(ymin, view_y[i]);
+    ymax = std::max(ymax, view_y[i]);
+  }
+}
+
+void PlotData2DView::get_datapoint_extremes(size_t _index, double &xmin, double &xmax, double &ymin, double &ymax) {
+  xmin = xmax = view_x[_index];
+  ymin = ymax = view_y[_index];
+}
+
+bool PlotData2DView::is_incremental_drawing_supported() {
+  return false;
+}
+
+void PlotData2DView::draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls) {
+  if (!is_showing() || view_x.empty())
+    return;
+
+  //contiguous arrays can be handed to PLplot directly
+  if (view_x.is_contiguous() && view_y.is_contiguous()) {
+    if (line_style != LineStyle::NONE) {
+      change_plstream_color(pls, color);
+      pls->lsty(line_style);
+      pls->width(line_width);
+      draw_line(pls, view_x.data, view_y.data, view_x.size);
+    }
+    if (!symbol.empty()) {
+      change_plstream_color(pls, symbol_color);
+      pls->schr(0, symbol_scale_factor);
+      draw_symbols(pls, view_x.data, view_y.data, view_x.size);
+    }
+    return;
+  }
+
+  //PLplot requires contiguous arrays: only the visible datapoints will be gathered
+  const bool sorted = draw_aux_data != nullptr && is_x_sorted();
+  const bool use_lod = sorted && lod_enabled && line_style != LineStyle::NONE;
+  size_t lo = 0, hi = view_x.size;
+  if (sorted)
+    get_visible_range(0, view_x.size, lo, hi);
+
+  std::vector<double> x_gathered, y_gathered;
+  if ((line_style != LineStyle::NONE && !use_lod) || !symbol.empty()) {
+    x_gathered.resize(hi - lo);
+    y_gathered.resize(hi - lo);
+    for (size_t i = lo ; i < hi ; i++) {
+      x_gathered[i - lo] = view_x[i];
+      y_gathered[i - lo] = view_y[i];
+    }
+  }
+
+  if (line_style != LineStyle::NONE) {
+    change_plstream_color(pls, color);
+    pls->lsty(line_style);
+    pls->width(line_width);
+    if (use_lod) {
+      //the level-of-detail pyramid reads the strided arrays directly
+      update_level_of_detail();
+      draw_line_level_of_detail(pls);
+    }
+    else {
+      draw_line(pls, x_gathered.data(), y_gathered.data(), x_gathered.size());
+    }
+  }
+
+  if (!symbol.empty()) {
+    change_plstream_color(pls, symbol_color);
+    pls->schr(0, symbol_scale_factor);
+    plot_symbols(pls, x_gathered.data(), y_gathered.data(), x_gathered.size());
+  }
+}
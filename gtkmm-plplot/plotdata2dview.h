@@ -0,0 +1,169 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_PLOTDATA_2D_VIEW_H
+#define GTKMMPLPLOT_PLOTDATA_2D_VIEW_H
+
+#include <gtkmm-plplot/plotdata2d.h>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \class PlotData2DView plotdata2dview.h <gtkmm-plplot/plotdata2dview.h>
+     *  \brief a class that will plot a dataset stored in caller-owned memory for a Plot2D plot
+     *
+     *  Instances of this class do not copy the X- and Y-values they are constructed with:
+     *  instead they keep pointers to memory owned by the caller, which will be passed to PLplot when drawing.
+     *  This avoids duplicating large datasets that are already stored by the application.
+     *  Both arrays may be strided, allowing for example to plot two columns of an interleaved, row-major table.
+     *  The caller is responsible for ensuring that the memory remains valid for as long as the dataset is
+     *  part of a plot, and must call notify_data_modified() after changing its contents in place,
+     *  or set_view() when the memory is moved or resized.
+     *  Since the memory is not owned by the dataset, the methods that add, remove or replace datapoints are not supported.
+     *  Important is that whenever a property is changed, \c signal_changed() is emitted, which will eventually
+     *  be picked up by the \c canvas that will hold the plot.
+     */
+    class PlotData2DView : public PlotData2D {
+    private:
+      PlotData2DView() = delete; ///< no default constructor
+      PlotData2DView &operator=(const PlotData2DView &) = delete; ///< no assignment operator
+      PlotData2DView(const PlotData2DView &source) = delete; ///< no default copy constructor;
+      virtual void add_datapoint(double xval, double yval) override; ///< disable this method
+      virtual void add_datapoint(std::pair<double, double> xy_pair) override; ///< disable this method
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y) override; ///< disable this method
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) override; ///< disable this method
+      virtual void append_datapoints(const double *x, const double *y, size_t n) override; ///< disable this method
+      virtual void remove_datapoint(size_t index) override; ///< disable this method
+      virtual void replace_datapoints(const std::vector<double> &x, const std::vector<double> &y) override; ///< disable this method
+      virtual void replace_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) override; ///< disable this method
+    protected:
+      DataView view_x; ///< The caller-owned X-values
+      DataView view_y; ///< The caller-owned Y-values
+
+      /** Get a view of the caller-owned X-values
+       *
+       * \return a view of the X-values
+       */
+      virtual DataView get_storage_view_x() override;
+
+      /** Get a view of the caller-owned Y-values
+       *
+       * \return a view of the Y-values
+       */
+      virtual DataView get_storage_view_y() override;
+
+      /** Calculate the data extremes by scanning the complete caller-owned dataset
+       *
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void calculate_extremes(double &xmin, double &xmax, double &ymin, double &ymax) override;
+
+      /** Get the extremes covered by a single caller-owned datapoint
+       *
+       * \param index the position of the datapoint in the dataset
+       * \param xmin X minimum value
+       * \param xmax X maximum value
+       * \param ymin Y minimum value
+       * \param ymax Y maximum value
+       */
+      virtual void get_datapoint_extremes(size_t index, double &xmin, double &xmax, double &ymin, double &ymax) override;
+
+      /** Check if the dataset supports incremental drawing
+       *
+       * \return \c false, since the caller-owned memory may be modified anywhere
+       */
+      virtual bool is_incremental_drawing_supported() override;
+    public:
+      /** Constructor
+       *
+       * This constructor initializes a new dataset that refers to \c n datapoints stored in caller-owned memory.
+       * The memory will not be copied and must remain valid as long as the dataset is part of a plot.
+       * Optionally, one can also use the constructor to override the default color, line style and line width.
+       * \param x pointer to the first X-value
+       * \param y pointer to the first Y-value
+       * \param n the number of datapoints
+       * \param stride_x the distance between two consecutive X-values, expressed in number of doubles
+       * \param stride_y the distance between two consecutive Y-values, expressed in number of doubles
+       * \param color the line color, default is red
+       * \param line_style the line style, default is CONTINUOUS
+       * \param line_width the line width, default is 1.0
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotData2DView(const double *x,
+                     const double *y,
+                     size_t n,
+                     size_t stride_x = 1,
+                     size_t stride_y = 1,
+                     Gdk::RGBA color = Gdk::RGBA("red"),
+                     LineStyle line_style = CONTINUOUS,
+                     double line_width = PLOTDATA_DEFAULT_LINE_WIDTH);
+
+      /** Destructor
+       *
+       */
+      virtual ~PlotData2DView();
+
+      /** Change the caller-owned memory the dataset refers to
+       *
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x pointer to the first X-value
+       * \param y pointer to the first Y-value
+       * \param n the number of datapoints
+       * \param stride_x the distance between two consecutive X-values, expressed in number of doubles
+       * \param stride_y the distance between two consecutive Y-values, expressed in number of doubles
+       * \exception Gtk::PLplot::Exception
+       */
+      void set_view(const double *x, const double *y, size_t n, size_t stride_x = 1, size_t stride_y = 1);
+
+      /** Inform the dataset that the contents of the caller-owned memory have been modified in place
+       *
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       */
+      void notify_data_modified();
+
+      /**
+       *
+       * \returns a copy of the dataset X-values
+       */
+      virtual std::vector<double> get_vector_x() override;
+
+      /**
+       *
+       * \returns a copy of the dataset Y-values
+       */
+      virtual std::vector<double> get_vector_y() override;
+
+      /**
+       *
+       * \returns the number of elements in the dataset
+       */
+      virtual size_t size() override;
+
+      /** Method to draw the dataset
+       *
+       * Contiguous arrays are passed directly to PLplot. Strided arrays require the visible datapoints to be gathered first.
+       * \param cr the cairo context to draw to.
+       * \param pls the PLplot plstream object that will do the actual plotting on the Cairo context
+       */
+      virtual void draw_plot_data(const Cairo::RefPtr<Cairo::Context> &cr, plstream *pls) override;
+    };
+  }
+}
+
+#endif
@@ -78,6 +78,7 @@ void PlotData3D::add_datapoint(double _x, double _y, double _z) {
   x.push_back(_x);
   y.push_back(_y);
   z.push_back(_z);
+  extremes_add_datapoint(x.size() - 1);
   _signal_data_modified.emit();
 }
 
@@ -85,10 +86,59 @@ void PlotData3D::add_datapoint(std::tuple<double, double, double> _xyz) {
   add_datapoint(std::get<0>(_xyz), std::get<1>(_xyz), std::get<2>(_xyz));
 }
 
+void PlotData3D::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> This method is not supported for PlotData3D");
+}
+
+void PlotData3D::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y) {
+  throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> This method is not supported for PlotData3D");
+}
+
+void PlotData3D::append_datapoints(const double *_x, const double *_y, size_t _n) {
+  throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> This method is not supported for PlotData3D");
+}
+
+void PlotData3D::append_datapoints(const std::vector<double> &_x, const std::vector<double> &_y, const std::vector<double> &_z) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _z.size()) {
+    throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> data arrays x, y and z must have the same size!");
+  }
+  append_datapoints(_x.data(), _y.data(), _z.data(), _x.size());
+}
+
+void PlotData3D::append_datapoints(const std::valarray<double> &_x, const std::valarray<double> &_y, const std::valarray<double> &_z) {
+  //ensure all arrays have the same size
+  if (_x.size() != _y.size() || _x.size() != _z.size()) {
+    throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> data arrays x, y and z must have the same size!");
+  }
+  append_datapoints(std::begin(_x), std::begin(_y), std::begin(_z), _x.size());
+}
+
+void PlotData3D::append_datapoints(const double *_x, const double *_y, const double *_z, size_t _n) {
+  if (_n == 0)
+    return;
+
+  if (_x == nullptr || _y == nullptr || _z == nullptr) {
+    throw Exception("Gtk::PLplot::PlotData3D::append_datapoints -> data arrays x, y and z cannot be NULL!");
+  }
+
+  size_t first = x.size();
+  x.insert(x.end(), _x, _x + _n);
+  y.insert(y.end(), _y, _y + _n);
+  z.insert(z.end(), _z, _z + _n);
+
+  for (size_t i = first ; i < x.size() ; i++)
+    extremes_add_datapoint(i);
+
+  _signal_data_modified.emit();
+}
+
 void PlotData3D::remove_datapoint(size_t _index) {
   if (_index >= x.size()) {
     throw Exception("Gtk::PLplot::PlotData3D::remove_datapoint -> invalid index!");
   }
+  extremes_remove_datapoint(_index);
+  invalidate_datapoint_caches();
   x.erase(x.begin() + _index);
   y.erase(y.begin() + _index);
   z.erase(z.begin() + _index);
@@ -130,6 +180,8 @@ void PlotData3D::replace_datapoints(const std::vector<double> &_x, const std::ve
   x.assign(_x.begin(), _x.end());
   y.assign(_y.begin(), _y.end());
   z.assign(_z.begin(), _z.end());
+  invalidate_extremes();
+  invalidate_datapoint_caches();
 
   _signal_data_modified.emit();
 }
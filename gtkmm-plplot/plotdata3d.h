@@ -85,6 +85,9 @@ namespace Gtk {
        * \exception Gtk::PLplot::Exception
        */
       virtual void replace_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) override;
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y) final; ///< disable this method
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y) final; ///< disable this method
+      virtual void append_datapoints(const double *x, const double *y, size_t n) final; ///< disable this method
     protected:
       std::vector<double> z; ///< The Z-values of the dataset
     public:
@@ -154,6 +157,48 @@ namespace Gtk {
        */
       virtual void add_datapoint(std::tuple<double, double, double> xyz_tuple);
 
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y and \c z.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * This method assumes that \c x, \c y and \c z are vectors of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::vector<double>
+       * \param y The Y-values to be added, as std::vector<double>
+       * \param z The Z-values to be added, as std::vector<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y and \c z.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * This method assumes that \c x, \c y and \c z are valarrays of equal length.
+       * An exception will be thrown otherwise.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, as std::valarray<double>
+       * \param y The Y-values to be added, as std::valarray<double>
+       * \param z The Z-values to be added, as std::valarray<double>
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const std::valarray<double> &x, const std::valarray<double> &y, const std::valarray<double> &z);
+
+      /** Append a block of datapoints to the dataset
+       *
+       * The datapoints will be added at the end of the std::vector's \c x, \c y and \c z.
+       * Contrary to calling add_datapoint() repeatedly, \c signal_data_modified() will be emitted only once.
+       * The data is copied from the arrays: they do not need to outlive this call.
+       * After this method is called, the plot will be automatically updated to reflect the changes.
+       * \param x The X-values to be added, an array containing at least \c n elements
+       * \param y The Y-values to be added, an array containing at least \c n elements
+       * \param z The Z-values to be added, an array containing at least \c n elements
+       * \param n The number of datapoints to be added
+       * \exception Gtk::PLplot::Exception
+       */
+      virtual void append_datapoints(const double *x, const double *y, const double *z, size_t n);
+
       /** Removes a single datapoint from the dataset.
        *
        * The datapoint at position \c index will be removed from the dataset if \c index is valid.
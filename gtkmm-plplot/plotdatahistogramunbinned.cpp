@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <gtkmm-plplot/exception.h>
 #include <gtkmm-plplot/utils.h>
 #include <algorithm>
+#include <thread>
 #include <plstream.h>
 
 using namespace Gtk::PLplot;
@@ -30,8 +31,6 @@ PlotDataHistogramUnbinned::PlotDataHistogramUnbinned(
   int _nbins) :
   Glib::ObjectBase("GtkmmPlplotPlotDataHistogramUnbinned"),
   PlotDataHistogram(_datmin, _datmax, _nbins),
-  x(nullptr),
-  y(nullptr),
   data(_data),
   ignore_outliers(false) {
 
@@ -49,16 +48,16 @@ PlotDataHistogramUnbinned::PlotDataHistogramUnbinned(
     _datmax,
     _nbins) {}
 
-PlotDataHistogramUnbinned::~PlotDataHistogramUnbinned() {
-  if (x)
-    delete[] x;
-  if (y)
-    delete[] y;
-}
+PlotDataHistogramUnbinned::~PlotDataHistogramUnbinned() {}
 
 void PlotDataHistogramUnbinned::add_datapoint(double value) {
   data.push_back(value);
-  rebin();
+
+  //the bins do not change: only the one that value belongs to needs to be updated
+  const int bin = get_bin(value);
+  if (bin >= 0)
+    y[bin]++;
+
   _signal_data_modified.emit();
 }
 
@@ -107,33 +106,78 @@ void PlotDataHistogramUnbinned::set_ignore_outliers(bool _ignore_outliers) {
   _signal_data_modified.emit();
 }
 
-void PlotDataHistogramUnbinned::rebin() {
-  if (x)
-    delete[] x;
-  x = new double[nbins];
+// binning a chunk of data
+// (int) truncates towards zero, as in plhist.c: values less than one bin width below datmin end up in the first bin
+static void bin_chunk(const double *data, size_t n, double datmin, double dx, int nbins, bool ignore_outliers, double *y) {
+  if (ignore_outliers == false) {
+    for (size_t i = 0; i < n; i++) {
+      const double position = (data[i] - datmin) / dx;
+      const int bin = position < 0.0 ? 0 : position < nbins ? (int) position : nbins - 1;
+      y[bin]++;
+    }
+  }
+  else {
+    for (size_t i = 0; i < n; i++) {
+      const double position = (data[i] - datmin) / dx;
+      if (position > -1.0 && position < nbins)
+        y[(int) position]++;
+    }
+  }
+}
+
+int PlotDataHistogramUnbinned::get_bin(double value) {
+  const double dx = ( datmax - datmin ) / nbins;
+  const double position = (value - datmin) / dx;
 
-  if (y)
-    delete[] y;
-  y = new double[nbins];
+  if (ignore_outliers == false)
+    return position < 0.0 ? 0 : position < nbins ? (int) position : nbins - 1;
+  else if (position > -1.0 && position < nbins)
+    return (int) position;
+
+  return -1;
+}
+
+void PlotDataHistogramUnbinned::rebin() {
+  x.assign(nbins, 0.0);
+  y.assign(nbins, 0.0);
 
   /* shamelessly stolen from plhist.c */
   double dx = ( datmax - datmin ) / nbins;
 
   for (int i = 0; i < nbins; i++ ) {
     x[i] = datmin + i * dx;
-    y[i] = 0.0;
   }
 
-  for (size_t i = 0; i < data.size(); i++ ) {
-    int bin = (int) ( ( data[i] - datmin ) / dx );
-    if (ignore_outliers == false) {
-      bin = bin > 0 ? bin : 0;
-      bin = bin < nbins ? bin : nbins - 1;
-      y[bin]++;
-    }
-    else if (bin >= 0 && bin < nbins ) {
-      y[bin]++;
-    }
+  //only split the data if each thread gets a chunk that is large enough to be worth it
+  const size_t min_chunk_size = 1 << 20;
+  const size_t hardware_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  const size_t n_threads = std::min(hardware_threads, std::max(data.size() / min_chunk_size, size_t(1)));
+
+  if (n_threads == 1) {
+    bin_chunk(data.data(), data.size(), datmin, dx, nbins, ignore_outliers, y.data());
+    return;
+  }
+
+  //each thread fills its own partial histogram, avoiding any contention
+  std::vector<std::vector<double>> partial_y(n_threads - 1, std::vector<double>(nbins, 0.0));
+  std::vector<std::thread> threads;
+  const size_t chunk_size = (data.size() + n_threads - 1) / n_threads;
+
+  for (size_t i = 1; i < n_threads; i++) {
+    const size_t first = std::min(i * chunk_size, data.size());
+    const size_t n = std::min(chunk_size, data.size() - first);
+    threads.emplace_back(bin_chunk, data.data() + first, n, datmin, dx, nbins, ignore_outliers, partial_y[i - 1].data());
+  }
+
+  //the first chunk is binned directly into y by the calling thread
+  bin_chunk(data.data(), std::min(chunk_size, data.size()), datmin, dx, nbins, ignore_outliers, y.data());
+
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &partial : partial_y) {
+    for (int i = 0; i < nbins; i++ )
+      y[i] += partial[i];
   }
 }
 
@@ -152,7 +196,7 @@ void PlotDataHistogramUnbinned::draw_plot_data(const Cairo::RefPtr<Cairo::Contex
     change_plstream_color(pls, color);
     pls->lsty(line_style);
     pls->width(line_width);
-    pls->bin(nbins, x, y, flags);
+    pls->bin(nbins, x.data(), y.data(), flags);
   }
 }
 
@@ -160,5 +204,5 @@ void PlotDataHistogramUnbinned::get_extremes(double &xmin, double &xmax, double
   xmin = datmin;
   xmax = datmax;
   ymin = 0.0;
-  ymax = 1.1 * *std::max_element(y, y + nbins);
+  ymax = 1.1 * *std::max_element(y.begin(), y.end());
 }
@@ -40,12 +40,24 @@ namespace Gtk {
       PlotDataHistogramUnbinned() = delete; ///< no default constructor
       PlotDataHistogramUnbinned &operator=(const PlotDataHistogramUnbinned &) = delete; ///< no assignment operator
       PlotDataHistogramUnbinned(const PlotDataHistogramUnbinned &source) = delete; ///< no default copy constructor;
-      double *x; ///< the X-values of the bins
-      double *y; ///< the Y-values (heights) of the bins
+      std::vector<double> x; ///< the X-values of the bins
+      std::vector<double> y; ///< the Y-values (heights) of the bins
     protected:
       std::vector<double> data; ///< unbinned data
       bool ignore_outliers; ///< flag that will determine what happens to outliers, i.e. data outside of datmin and datmax
-      void rebin(); ///< rebin the data
+
+      /** Rebin the data
+       *
+       * Large datasets are split in chunks that are binned concurrently into partial histograms, which are summed afterwards.
+       */
+      void rebin();
+
+      /** Get the bin that a value belongs to
+       *
+       * \param value the value
+       * \return the index of the bin, or -1 if \c value is an outlier that should be ignored
+       */
+      int get_bin(double value);
     public:
       /** Constructor
        *
@@ -26,11 +26,10 @@ using namespace Gtk::PLplot;
 
 PlotDataSurface::PlotDataSurface(
   const std::vector<double> &_x,
-  const std::vector<double> &_y,
-  double **_z) :
+  const std::vector<double> &_y) :
 	Glib::ObjectBase("GtkmmPLplotPlotDataSurface"),
   PlotData(),
-  x(_x), y(_y)
+  x(_x), y(_y), z_data(nullptr)
   {
     //do some checks
     //ensure there are at least two elements in the arrays
@@ -46,12 +45,54 @@ PlotDataSurface::PlotDataSurface(
     if (!std::is_sorted(y.begin(), y.end(), std::less_equal<double>())) {
       throw Exception("Gtk::PLplot::PlotDataSurface::PlotDataSurface -> data arrays y must consist of unique elements and be sorted in ascending order");
     }
+}
+
+PlotDataSurface::PlotDataSurface(
+  const std::vector<double> &_x,
+  const std::vector<double> &_y,
+  double **_z) :
+  PlotDataSurface(_x, _y) {
+    if (_z == nullptr) {
+      throw Exception("Gtk::PLplot::PlotDataSurface::PlotDataSurface -> data array z cannot be NULL!");
+    }
 
-    //allocate memory for z. This could easily segfault if bad input was provided
-		if (_z)
-    	z = deep_copy_array2d(_z, x.size(), y.size());
+    //copy the rows into the contiguous storage. This could easily segfault if bad input was provided
+    z_storage.resize(x.size() * y.size());
+    for (size_t i = 0 ; i < x.size() ; i++)
+      std::copy(_z[i], _z[i] + y.size(), z_storage.begin() + i * y.size());
+    z_data = z_storage.data();
+    init_z_rows();
+}
+
+PlotDataSurface::PlotDataSurface(
+  const std::vector<double> &_x,
+  const std::vector<double> &_y,
+  const double *_z,
+  bool _copy) :
+  PlotDataSurface(_x, _y) {
+    if (_z == nullptr) {
+      throw Exception("Gtk::PLplot::PlotDataSurface::PlotDataSurface -> data array z cannot be NULL!");
+    }
+
+    if (_copy) {
+      z_storage.assign(_z, _z + x.size() * y.size());
+      z_data = z_storage.data();
+    }
+    else {
+      z_data = _z;
+    }
+    init_z_rows();
 }
 
+PlotDataSurface::PlotDataSurface(
+  unsigned int nx,
+  unsigned int ny,
+  const double *_z,
+  bool _copy) :
+  PlotDataSurface(std::vector<double>(indgen(nx)),
+  std::vector<double>(indgen(ny)),
+  _z, _copy) {}
+
 PlotDataSurface::PlotDataSurface(
   const std::valarray<double> &_x,
   const std::valarray<double> &_y,
@@ -75,11 +116,22 @@ PlotDataSurface::PlotDataSurface(
   const std::vector<double> &_x,
   const std::vector<double> &_y,
   const boost::multi_array<double, 2> &_z) :
-  PlotDataSurface(_x, _y,
-  nullptr) {
+  PlotDataSurface(_x, _y) {
     if (_z.shape()[0] != _x.size() || _z.shape()[1] != _y.size())
       throw Exception("Gtk::PLplot::PlotDataSurface::PlotDataSurface -> dimensions of x and/or y do not match those of z");
-		z = boost_multi_array_to_array2d(_z);
+
+    if (_z.storage_order() == boost::c_storage_order()) {
+      //a single copy suffices
+      z_storage.assign(_z.data(), _z.data() + _z.num_elements());
+    }
+    else {
+      z_storage.resize(_z.num_elements());
+      for (size_t i = 0 ; i < x.size() ; i++)
+        for (size_t j = 0 ; j < y.size() ; j++)
+          z_storage[i * y.size() + j] = _z[i][j];
+    }
+    z_data = z_storage.data();
+    init_z_rows();
   }
 
 PlotDataSurface::PlotDataSurface(
@@ -98,8 +150,12 @@ PlotDataSurface::PlotDataSurface(
 
 #endif
 
-PlotDataSurface::~PlotDataSurface() {
-  free_array2d((void **) z, x.size());
+PlotDataSurface::~PlotDataSurface() {}
+
+void PlotDataSurface::init_z_rows() {
+  z_rows.resize(x.size());
+  for (size_t i = 0 ; i < x.size() ; i++)
+    z_rows[i] = z_data + i * y.size();
 }
 
 std::vector<double> PlotDataSurface::get_vector_x() {
@@ -111,5 +167,24 @@ std::vector<double> PlotDataSurface::get_vector_y() {
 }
 
 double **PlotDataSurface::get_array2d_z() {
-	return deep_copy_array2d(z, x.size(), y.size());
+	double **rv = calloc_array2d(x.size(), y.size());
+	for (size_t i = 0 ; i < x.size() ; i++)
+		std::copy(z_rows[i], z_rows[i] + y.size(), rv[i]);
+	return rv;
+}
+
+DataView PlotDataSurface::get_view_x() const {
+  return DataView(x.data(), x.size());
+}
+
+DataView PlotDataSurface::get_view_y() const {
+  return DataView(y.data(), y.size());
+}
+
+const double * const *PlotDataSurface::get_view_z() const {
+  return z_rows.data();
+}
+
+DataView PlotDataSurface::get_contiguous_view_z() const {
+  return DataView(z_data, x.size() * y.size());
 }
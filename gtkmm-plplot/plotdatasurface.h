@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 #include <gtkmm-plplot/plotdata.h>
 #include <gtkmm-plplot/enums.h>
+#include <gtkmm-plplot/dataview.h>
 #include <vector>
 #include <valarray>
 
@@ -34,7 +35,11 @@ namespace Gtk {
      *
      *  Instances of this class will hold a single (and the only possible) dataset for
      *  a surface plot types like PlotContour and PlotContourShades. The input data can be provided
-     *  as std::vector (X and Y), std::valarray (X and Y), double** (Z, array of arrays) and boost:multi_array (Z).
+     *  as std::vector (X and Y), std::valarray (X and Y), double** (Z, array of arrays), const double* (Z, contiguous row-major array)
+     *  and boost:multi_array (Z).
+     *  Internally, Z is stored in a single contiguous buffer in row-major order, complemented with a table of row pointers
+     *  that is built once and passed to PLplot directly.
+     *  The buffer may also be owned by the caller, avoiding the copy altogether.
      *  This datatype is demonstrated in \ref example7.
      */
     class PlotDataSurface : public PlotData {
@@ -43,10 +48,27 @@ namespace Gtk {
       PlotDataSurface() = delete; ///< no default constructor
       PlotDataSurface(const PlotDataSurface &) = delete; ///< no copy constructor
       PlotDataSurface &operator=(const PlotDataSurface &) = delete; ///< no assignment operator
+
+      /** Constructor
+       *
+       * Validates the grid coordinates, leaving the Z-values uninitialized.
+       * \param x the X-grid coordinates of the dataset
+       * \param y the Y-grid coordinates of the dataset
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotDataSurface(const std::vector<double> &x,
+                      const std::vector<double> &y);
     protected:
       std::vector<double> x; ///< The X-grid coordinates of the dataset, which are assumed to correspond to the first dimension of Z
       std::vector<double> y; ///< The Y-grid coordinates of the dataset, which are assumed to correspond to the second dimension of Z
-      double **z; ///< The Z-values of the dataset. This is an array of arrays whose first dimension must correspond to the length of x, while the second must correspond to the length of y.
+      std::vector<double> z_storage; ///< The Z-values of the dataset in row-major order, if owned by the dataset. Empty if the caller owns the Z-values.
+      const double *z_data; ///< The Z-values of the dataset, stored contiguously in row-major order. Its first dimension corresponds to the length of x, while the second corresponds to the length of y.
+      std::vector<const double *> z_rows; ///< The row pointers into \c z_data, as required by PLplot
+
+      /** Build the table of row pointers into \c z_data
+       *
+       */
+      void init_z_rows();
     public:
       /** Constructor
        *
@@ -83,6 +105,36 @@ namespace Gtk {
                       unsigned int ny,
                       double **z);
 
+      /** Constructor
+       *
+       * Initializes a new dataset for a PlotContour, using Z-values that are stored contiguously in row-major order.
+       * \param x the X-grid coordinates of the dataset, provided as a std::vector. Have to match the first dimension of z
+       * \param y the Y-grid coordinates of the dataset, provided as a std::vector. Have to match the second dimension of z
+       * \param z the actual surface data, provided as an array of \c x.size() times \c y.size() elements, with the elements along the second dimension stored consecutively.
+       * \param copy if \c true, the constructor will initialize its own copy of \c z. If \c false, \c z will be used directly and must remain valid for the lifetime of the dataset.
+       * This allows for example to plot the contents of a Boost \c multi_array with C storage order without copying it, by passing its \c data().
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotDataSurface(const std::vector<double> &x,
+                      const std::vector<double> &y,
+                      const double *z,
+                      bool copy = true);
+
+      /** Constructor
+       *
+       * Initializes a new dataset for a PlotContour, using Z-values that are stored contiguously in row-major order.
+       * The X- and Y-values will be set to a vector of the appropriate size with elements set to correspond to their array subscript.
+       * \param nx the extent of z along the first dimension
+       * \param ny the extent of z along the second dimension
+       * \param z the actual surface data, provided as an array of \c nx times \c ny elements, with the elements along the second dimension stored consecutively.
+       * \param copy if \c true, the constructor will initialize its own copy of \c z. If \c false, \c z will be used directly and must remain valid for the lifetime of the dataset.
+       * \exception Gtk::PLplot::Exception
+       */
+      PlotDataSurface(unsigned int nx,
+                      unsigned int ny,
+                      const double *z,
+                      bool copy = true);
+
 #ifdef GTKMM_PLPLOT_BOOST_ENABLED
       /** Constructor
        *
@@ -134,9 +186,39 @@ namespace Gtk {
 
       /**
        * Free the memory with free_array2d().
-       * \returns a copy of the dataset Z-values
+       * \returns a copy of the dataset Z-values. Use get_view_z() to avoid the copy.
        */
       double **get_array2d_z();
+
+      /** Get a read-only view of the dataset X-values, without copying them
+       *
+       * The view remains valid until the dataset is destroyed.
+       * \returns a view of the dataset X-values
+       */
+      DataView get_view_x() const;
+
+      /** Get a read-only view of the dataset Y-values, without copying them
+       *
+       * The view remains valid until the dataset is destroyed.
+       * \returns a view of the dataset Y-values
+       */
+      DataView get_view_y() const;
+
+      /** Get read-only access to the dataset Z-values, without copying them
+       *
+       * The returned array of arrays is owned by the dataset and must not be freed.
+       * It remains valid until the dataset is destroyed.
+       * \returns the dataset Z-values
+       */
+      const double * const *get_view_z() const;
+
+      /** Get read-only access to the contiguous storage of the dataset Z-values, without copying them
+       *
+       * The elements are stored in row-major order: the element at position (i, j) is found at index i * ny + j.
+       * It remains valid until the dataset is destroyed.
+       * \returns a view of the dataset Z-values
+       */
+      DataView get_contiguous_view_z() const;
     };
   }
 }
@@ -0,0 +1,163 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/renderer.h>
+#include <gtkmm-plplot/plot.h>
+#include <gtkmm-plplot/exception.h>
+#include <gdkmm/general.h>
+#include <cmath>
+#include <algorithm>
+
+using namespace Gtk::PLplot;
+
+Renderer::Renderer(Gdk::RGBA _background_color) :
+  background_color(_background_color) {}
+
+Renderer::Renderer(Plot &plot, Gdk::RGBA _background_color) :
+  background_color(_background_color) {
+  add_plot(plot);
+}
+
+Renderer::~Renderer() {
+  for (auto &iter : plots) {
+    if (iter->is_managed_()) {
+      delete iter;
+    }
+  }
+}
+
+void Renderer::add_plot(Plot &plot) {
+  // ensure plot is not already present
+  auto iter = std::find(plots.begin(), plots.end(), &plot);
+  if (iter != plots.end())
+    throw Exception("Gtk::PLplot::Renderer::add_plot -> Plot has been added before to this renderer");
+
+  plots.push_back(&plot);
+}
+
+void Renderer::remove_plot(unsigned int index) {
+  if (plots.empty())
+    throw Exception("Gtk::PLplot::Renderer::remove_plot -> No plots on renderer");
+
+  if (index >= plots.size())
+    throw Exception("Gtk::PLplot::Renderer::remove_plot -> Invalid index");
+
+  if (plots[index]->is_managed_())
+    delete plots[index];
+
+  plots.erase(plots.begin() + index);
+}
+
+void Renderer::remove_plot(Plot &plot) {
+  if (plots.empty())
+    throw Exception("Gtk::PLplot::Renderer::remove_plot -> No plots on renderer");
+
+  auto iter = std::find(plots.begin(), plots.end(), &plot);
+  if (iter == plots.end())
+    throw Exception("Gtk::PLplot::Renderer::remove_plot -> No match for input");
+
+  if ((*iter)->is_managed_())
+    delete *iter;
+
+  plots.erase(iter);
+}
+
+Plot *Renderer::get_plot(unsigned int index) {
+  if (plots.empty())
+    throw Exception("Gtk::PLplot::Renderer::get_plot -> No plots on renderer");
+
+  if (index >= plots.size())
+    throw Exception("Gtk::PLplot::Renderer::get_plot -> Invalid index");
+
+  return plots[index];
+}
+
+Gdk::RGBA Renderer::get_background_color() {
+  return background_color;
+}
+
+void Renderer::set_background_color(Gdk::RGBA _background_color) {
+  background_color = _background_color;
+}
+
+void Renderer::render(const Cairo::RefPtr<Cairo::Context> &cr, int width, int height) {
+  if (width <= 0 || height <= 0)
+    throw Exception("Gtk::PLplot::Renderer::render -> width and height must be strictly positive");
+
+  cr->save();
+
+  //start by drawing the background...
+  cr->rectangle(0.0, 0.0, width, height);
+  Gdk::Cairo::set_source_rgba(cr, background_color);
+  cr->fill();
+
+  //...followed by the plots, according to their order in the plots vector
+  for (auto &iter : plots) {
+    iter->draw_plot(cr, width, height);
+  }
+
+  cr->restore();
+}
+
+void Renderer::render(const Cairo::RefPtr<Cairo::Surface> &surface, int width, int height) {
+  if (!surface)
+    throw Exception("Gtk::PLplot::Renderer::render -> surface cannot be NULL");
+
+  auto cr = Cairo::Context::create(surface);
+  render(cr, width, height);
+  cr.reset();
+  surface->flush();
+}
+
+void Renderer::render_to_png(const std::string &filename, int width, int height, double scale) {
+  if (width <= 0 || height <= 0)
+    throw Exception("Gtk::PLplot::Renderer::render_to_png -> width and height must be strictly positive");
+
+  if (scale <= 0.0)
+    throw Exception("Gtk::PLplot::Renderer::render_to_png -> scale must be strictly positive");
+
+  auto surface = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, std::ceil(width * scale), std::ceil(height * scale));
+  surface->set_device_scale(scale, scale);
+  render(surface, width, height);
+  surface->write_to_png(filename);
+}
+
+void Renderer::render_to_pdf(const std::string &filename, int width, int height) {
+#ifdef CAIRO_HAS_PDF_SURFACE
+  if (width <= 0 || height <= 0)
+    throw Exception("Gtk::PLplot::Renderer::render_to_pdf -> width and height must be strictly positive");
+
+  auto surface = Cairo::PdfSurface::create(filename, width, height);
+  render(surface, width, height);
+  surface->finish();
+#else
+  throw Exception("Gtk::PLplot::Renderer::render_to_pdf -> Cairo was built without PDF support");
+#endif
+}
+
+void Renderer::render_to_svg(const std::string &filename, int width, int height) {
+#ifdef CAIRO_HAS_SVG_SURFACE
+  if (width <= 0 || height <= 0)
+    throw Exception("Gtk::PLplot::Renderer::render_to_svg -> width and height must be strictly positive");
+
+  auto surface = Cairo::SvgSurface::create(filename, width, height);
+  render(surface, width, height);
+  surface->finish();
+#else
+  throw Exception("Gtk::PLplot::Renderer::render_to_svg -> Cairo was built without SVG support");
+#endif
+}
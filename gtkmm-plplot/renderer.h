@@ -0,0 +1,161 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_RENDERER_H
+#define GTKMMPLPLOT_RENDERER_H
+
+#include <vector>
+#include <string>
+#include <cairomm/cairomm.h>
+#include <gdkmm/rgba.h>
+
+namespace Gtk {
+  namespace PLplot {
+    class Plot;
+
+    /** \class Renderer renderer.h <gtkmm-plplot/renderer.h>
+     *  \brief renders plots without a widget, onto a Cairo surface or straight to a file
+     *
+     *  This class offers the drawing functionality of Canvas, without being a widget: it does not require
+     *  a display connection, nor a running main loop, making it suitable for generating plots in batch jobs,
+     *  command-line tools and worker processes.
+     *  Plots are added and removed exactly like they are with a Canvas, and are drawn in the order they were added,
+     *  on top of the background color.
+     *  Since PLplot is not thread-safe, a process should not render plots on several threads at the same time:
+     *  use several processes instead.
+     */
+    class Renderer {
+    private:
+      Renderer(const Renderer &) = delete; ///< no copy constructor
+      Renderer &operator=(const Renderer &) = delete; ///< no assignment operator
+    protected:
+      std::vector<Plot *> plots; ///< A vector containing pointers to the plots
+      Gdk::RGBA background_color; ///< the currently used background color (default = opaque White)
+    public:
+      /** Constructor
+       *
+       * This constructor produces a renderer without plots: add them using add_plot.
+       * \param background_color The color of the background.
+       */
+      Renderer(Gdk::RGBA background_color = Gdk::RGBA("White"));
+
+      /** Constructor
+       *
+       * This constructor produces a renderer with a single plot.
+       * More plots may be added using add_plot.
+       * \param plot The plot that will be rendered.
+       * \param background_color The color of the background.
+       */
+      Renderer(Plot &plot, Gdk::RGBA background_color = Gdk::RGBA("White"));
+
+      /** Destructor
+       *
+       * Managed plots will be deleted.
+       */
+      virtual ~Renderer();
+
+      /** Add a single plot to the renderer
+       *
+       * \param plot The plot that will be added
+       * \exception Gtk::PLplot::Exception
+       */
+      void add_plot(Plot &plot);
+
+      /** Remove a single plot from the renderer
+       *
+       * \param plot_index The index of the plot that will be removed.
+       * \exception Gtk::PLplot::Exception
+       */
+      void remove_plot(unsigned int plot_index);
+
+      /** Remove a single plot from the renderer
+       *
+       * \param plot The plot that will be removed.
+       * \exception Gtk::PLplot::Exception
+       */
+      void remove_plot(Plot &plot);
+
+      /** Get a pointer to a plot contained by the renderer
+       *
+       * \param plot_index The index of the plot.
+       * \return a pointer to the plot
+       * \exception Gtk::PLplot::Exception
+       */
+      Plot *get_plot(unsigned int plot_index);
+
+      /** Get the background color
+       *
+       * \return the background color
+       */
+      Gdk::RGBA get_background_color();
+
+      /** Set the background color
+       *
+       * \param color The new background color
+       */
+      void set_background_color(Gdk::RGBA color);
+
+      /** Render the background and all plots onto a Cairo context
+       *
+       * \param cr the cairo context to draw to.
+       * \param width the width of the area to draw to, in Cairo units
+       * \param height the height of the area to draw to, in Cairo units
+       * \exception Gtk::PLplot::Exception
+       */
+      void render(const Cairo::RefPtr<Cairo::Context> &cr, int width, int height);
+
+      /** Render the background and all plots onto a caller-supplied Cairo surface
+       *
+       * \param surface the surface to draw to.
+       * \param width the width of the area to draw to, in Cairo units
+       * \param height the height of the area to draw to, in Cairo units
+       * \exception Gtk::PLplot::Exception
+       */
+      void render(const Cairo::RefPtr<Cairo::Surface> &surface, int width, int height);
+
+      /** Render the background and all plots to a PNG file
+       *
+       * \param filename the name of the PNG file
+       * \param width the width of the image, in Cairo units
+       * \param height the height of the image, in Cairo units
+       * \param scale the number of pixels per Cairo unit, allowing high-resolution images to be produced with the same layout
+       * \exception Gtk::PLplot::Exception
+       */
+      void render_to_png(const std::string &filename, int width, int height, double scale = 1.0);
+
+      /** Render the background and all plots to a PDF file
+       *
+       * \param filename the name of the PDF file
+       * \param width the width of the page, in points
+       * \param height the height of the page, in points
+       * \exception Gtk::PLplot::Exception
+       */
+      void render_to_pdf(const std::string &filename, int width, int height);
+
+      /** Render the background and all plots to an SVG file
+       *
+       * \param filename the name of the SVG file
+       * \param width the width of the image, in points
+       * \param height the height of the image, in points
+       * \exception Gtk::PLplot::Exception
+       */
+      void render_to_svg(const std::string &filename, int width, int height);
+    };
+  }
+}
+
+#endif
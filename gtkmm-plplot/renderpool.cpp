@@ -0,0 +1,96 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/renderpool.h>
+
+using namespace Gtk::PLplot;
+
+RenderPool::RenderPool(unsigned int n_threads) :
+  quit(false),
+  jobs(nullptr),
+  next_job(0),
+  unfinished_jobs(0) {
+
+  if (n_threads == 0) {
+    const unsigned int hardware_threads = std::thread::hardware_concurrency();
+    n_threads = hardware_threads > 1 ? hardware_threads - 1 : 1;
+  }
+
+  for (unsigned int i = 0 ; i < n_threads ; i++)
+    threads.emplace_back(&RenderPool::run, this);
+}
+
+RenderPool::~RenderPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
+  }
+  condition.notify_all();
+  for (auto &thread : threads)
+    thread.join();
+}
+
+void RenderPool::run_job(std::unique_lock<std::mutex> &lock, size_t job_index) {
+  lock.unlock();
+  try {
+    (*jobs)[job_index]();
+  }
+  catch (...) {
+    lock.lock();
+    if (!error)
+      error = std::current_exception();
+    lock.unlock();
+  }
+  lock.lock();
+
+  if (--unfinished_jobs == 0)
+    finished_condition.notify_all();
+}
+
+void RenderPool::run() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    condition.wait(lock, [this](){return quit || (jobs != nullptr && next_job < jobs->size());});
+    if (quit)
+      return;
+    run_job(lock, next_job++);
+  }
+}
+
+void RenderPool::run_jobs(const std::vector<std::function<void()>> &_jobs) {
+  if (_jobs.empty())
+    return;
+
+  std::unique_lock<std::mutex> lock(mutex);
+  jobs = &_jobs;
+  next_job = 0;
+  unfinished_jobs = _jobs.size();
+  error = nullptr;
+  condition.notify_all();
+
+  while (next_job < jobs->size())
+    run_job(lock, next_job++);
+
+  finished_condition.wait(lock, [this](){return unfinished_jobs == 0;});
+  jobs = nullptr;
+
+  if (error) {
+    std::exception_ptr _error = error;
+    error = nullptr;
+    std::rethrow_exception(_error);
+  }
+}
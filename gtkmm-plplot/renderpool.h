@@ -0,0 +1,96 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_RENDERPOOL_H
+#define GTKMMPLPLOT_RENDERPOOL_H
+
+#include <vector>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \class RenderPool renderpool.h <gtkmm-plplot/renderpool.h>
+     *  \brief a fixed-size pool of threads that runs batches of independent rendering jobs
+     *
+     *  This class is used internally by Canvas in parallel rasterization mode and is not part of the public API.
+     *  The jobs must not make any PLplot calls, since PLplot is not thread-safe.
+     */
+    class RenderPool {
+    private:
+      RenderPool(const RenderPool &) = delete; ///< no copy constructor
+      RenderPool &operator=(const RenderPool &) = delete; ///< no assignment operator
+
+      std::vector<std::thread> threads; ///< the worker threads
+      std::mutex mutex; ///< protects all members below, accessed by all threads
+      std::condition_variable condition; ///< wakes up the worker threads when a batch is started or the pool should quit
+      std::condition_variable finished_condition; ///< wakes up the thread that started the batch when all jobs have finished
+      bool quit; ///< set to true when the worker threads should terminate
+      const std::vector<std::function<void()>> *jobs; ///< the jobs of the current batch, or nullptr if no batch is running
+      size_t next_job; ///< the index of the next job in \c jobs that should be started
+      size_t unfinished_jobs; ///< the number of jobs in \c jobs that have not finished yet
+      std::exception_ptr error; ///< the first exception thrown by a job of the current batch
+
+      /** Run a job of the current batch and update the bookkeeping
+       *
+       * Must be called with \c lock held, which is released while the job is running.
+       * \param lock the lock on \c mutex
+       * \param job_index the index of the job in \c jobs
+       */
+      void run_job(std::unique_lock<std::mutex> &lock, size_t job_index);
+
+      /** The main loop of the worker threads
+       *
+       */
+      void run();
+    public:
+      /** Constructor
+       *
+       * Starts the worker threads.
+       * \param n_threads the number of worker threads. If 0, one less than the number of hardware threads will be used, since the calling thread also participates in run_jobs()
+       */
+      RenderPool(unsigned int n_threads = 0);
+
+      /** Destructor
+       *
+       * Stops the worker threads.
+       */
+      ~RenderPool();
+
+      /** Run a batch of jobs concurrently and wait until all of them have finished
+       *
+       * The calling thread takes part in running the jobs. Must not be called concurrently from several threads.
+       * If any job throws an exception, the first one will be rethrown after all jobs have finished.
+       * \param jobs the jobs to run
+       */
+      void run_jobs(const std::vector<std::function<void()>> &jobs);
+
+      /** Get the number of threads that will run the jobs, including the calling thread
+       *
+       * \return the number of threads
+       */
+      unsigned int get_n_threads() const {
+        return threads.size() + 1;
+      }
+    };
+  }
+}
+
+#endif
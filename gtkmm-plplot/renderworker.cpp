@@ -0,0 +1,119 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <gtkmm-plplot/renderworker.h>
+#include <gdkmm/general.h>
+#include <cmath>
+
+using namespace Gtk::PLplot;
+
+RenderWorker::RenderWorker() :
+  quit(false),
+  pending_valid(false),
+  finished_valid(false) {
+
+  dispatcher.connect(sigc::mem_fun(*this, &RenderWorker::on_dispatch));
+  thread = std::thread(&RenderWorker::run, this);
+}
+
+RenderWorker::~RenderWorker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    quit = true;
+  }
+  condition.notify_one();
+  thread.join();
+}
+
+void RenderWorker::submit(unsigned long generation, const std::vector<Layer> &layers, const Gdk::RGBA &background_color, int width, int height, double scale) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.generation = generation;
+    pending.layers = layers;
+    pending.background_color = background_color;
+    pending.width = width;
+    pending.height = height;
+    pending.scale = scale;
+    pending_valid = true;
+  }
+  condition.notify_one();
+}
+
+void RenderWorker::run() {
+  while (true) {
+    Frame frame;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this](){return quit || pending_valid;});
+      if (quit)
+        return;
+      frame = pending;
+      pending.layers.clear();
+      pending_valid = false;
+    }
+
+    //the main thread does not touch the recordings and images until the frame has been delivered
+    for (auto &layer : frame.layers) {
+      if (!layer.recording)
+        continue;
+      auto layer_cr = Cairo::Context::create(layer.image);
+      layer_cr->set_operator(Cairo::Context::Operator::SOURCE);
+      layer_cr->set_source(layer.recording, 0.0, 0.0);
+      layer_cr->paint();
+      layer_cr.reset();
+      layer.image->flush();
+    }
+
+    frame.image = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32,
+                                              std::ceil(frame.width * frame.scale),
+                                              std::ceil(frame.height * frame.scale));
+    frame.image->set_device_scale(frame.scale, frame.scale);
+    auto cr = Cairo::Context::create(frame.image);
+    cr->rectangle(0.0, 0.0, frame.width, frame.height);
+    Gdk::Cairo::set_source_rgba(cr, frame.background_color);
+    cr->fill();
+    for (auto &layer : frame.layers) {
+      cr->set_source(layer.image, layer.offset_x, layer.offset_y);
+      cr->paint();
+    }
+    cr.reset();
+    frame.image->flush();
+    //release the recordings, and with them the layers of the plots they reference, before the main thread takes over again
+    frame.layers.clear();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      finished = frame;
+      finished_valid = true;
+    }
+    dispatcher.emit();
+  }
+}
+
+void RenderWorker::on_dispatch() {
+  Frame frame;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!finished_valid)
+      return;
+    frame = finished;
+    finished.image.reset();
+    finished_valid = false;
+  }
+
+  _signal_finished.emit(frame.generation, frame.image);
+}
@@ -0,0 +1,127 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GTKMMPLPLOT_RENDERWORKER_H
+#define GTKMMPLPLOT_RENDERWORKER_H
+
+#include <cairomm/cairomm.h>
+#include <gdkmm/rgba.h>
+#include <glibmm/dispatcher.h>
+#include <sigc++/sigc++.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+
+namespace Gtk {
+  namespace PLplot {
+    /** \class RenderWorker renderworker.h <gtkmm-plplot/renderworker.h>
+     *  \brief rasterizes the plots of a Canvas and composites them on a background thread
+     *
+     *  This class is used internally by Canvas in asynchronous rasterization mode and is not part of the public API.
+     *  Since PLplot is not thread-safe, all PLplot calls remain on the main thread, where the plots that changed are drawn onto Cairo recording surfaces.
+     *  Replaying these recordings onto the offscreen surfaces of their plots, and compositing those into a frame, happens on the worker thread.
+     *  signal_finished() is emitted on the main thread when a frame is ready. Since the offscreen surfaces of the plots are drawn onto by the worker,
+     *  the main thread must not access them, nor submit another frame, until then.
+     */
+    class RenderWorker {
+    private:
+      RenderWorker(const RenderWorker &) = delete; ///< no copy constructor
+      RenderWorker &operator=(const RenderWorker &) = delete; ///< no assignment operator
+    public:
+      /** \struct Layer
+       *  \brief a plot that is part of a frame
+       */
+      struct Layer {
+        Cairo::RefPtr<Cairo::ImageSurface> image; ///< the offscreen surface of the plot
+        Cairo::RefPtr<Cairo::RecordingSurface> recording; ///< the recording that must be rasterized onto \c image first, or nullptr if \c image is up to date
+        int offset_x; ///< the horizontal position of \c image within the frame, in Cairo units
+        int offset_y; ///< the vertical position of \c image within the frame, in Cairo units
+      };
+    private:
+
+      /** \struct Frame
+       *  \brief a frame that was submitted for rasterization, or that has been rasterized
+       */
+      struct Frame {
+        unsigned long generation; ///< the generation of the frame, as provided by the caller
+        std::vector<Layer> layers; ///< the plots, in the order they must be composited
+        Gdk::RGBA background_color; ///< the background of the frame
+        int width; ///< the width of the frame in Cairo units
+        int height; ///< the height of the frame in Cairo units
+        double scale; ///< the device scale of the rasterized frame
+        Cairo::RefPtr<Cairo::ImageSurface> image; ///< the rasterized frame
+      };
+
+      std::thread thread; ///< the worker thread
+      std::mutex mutex; ///< protects all members below, accessed by both threads
+      std::condition_variable condition; ///< wakes up the worker thread when a frame is submitted or the worker should quit
+      bool quit; ///< set to true when the worker thread should terminate
+      bool pending_valid; ///< set to true if \c pending contains a frame that has not been rasterized yet
+      Frame pending; ///< the submitted frame
+      bool finished_valid; ///< set to true if \c finished contains a frame that has not been delivered to the main thread yet
+      Frame finished; ///< the most recently rasterized frame
+      Glib::Dispatcher dispatcher; ///< notifies the main thread of a rasterized frame
+      sigc::signal<void(unsigned long, Cairo::RefPtr<Cairo::ImageSurface>)> _signal_finished; ///< signal emitted on the main thread when a frame has been rasterized
+
+      /** The main loop of the worker thread
+       *
+       */
+      void run();
+
+      /** Delivers the rasterized frame on the main thread
+       *
+       */
+      void on_dispatch();
+    public:
+      /** Constructor
+       *
+       * Starts the worker thread. Must be called on the main thread.
+       */
+      RenderWorker();
+
+      /** Destructor
+       *
+       * Stops the worker thread, after it finished rasterizing the frame it is currently working on.
+       */
+      ~RenderWorker();
+
+      /** Submit a frame for rasterization
+       *
+       * Must not be called again before signal_finished() has been emitted for the previous frame.
+       * The recordings and images of the layers must not be accessed by the caller until then.
+       * \param generation a number that identifies the frame, which will be passed to signal_finished()
+       * \param layers the plots, in the order they must be composited
+       * \param background_color the background of the frame
+       * \param width the width of the frame in Cairo units
+       * \param height the height of the frame in Cairo units
+       * \param scale the device scale of the rasterized frame
+       */
+      void submit(unsigned long generation, const std::vector<Layer> &layers, const Gdk::RGBA &background_color, int width, int height, double scale);
+
+      /** signal_finished is emitted on the main thread whenever a frame has been rasterized
+       *
+       * \return signal
+       */
+      sigc::signal<void(unsigned long, Cairo::RefPtr<Cairo::ImageSurface>)> signal_finished() {
+        return _signal_finished;
+      }
+    };
+  }
+}
+
+#endif
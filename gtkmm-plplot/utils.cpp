@@ -16,21 +16,34 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include <gtkmm-plplot/utils.h>
+#include <gtkmm-plplot/exception.h>
 #include <string>
 #include <cstdlib>
 #include <cstring>
+#include <cstddef>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
 #include <plstream.h>
+#include <gtkmm-plplot/colormaps.h>
 
-static std::vector<Glib::ustring> _colormaps = {
-  "cmap1_default.pal",
-  "cmap1_blue_red.pal",
-  "cmap1_blue_yellow.pal",
-  "cmap1_gray.pal",
-  "cmap1_highfreq.pal",
-  "cmap1_lowfreq.pal",
-  "cmap1_radar.pal"
+//the number of colors of the cmap1 tables that are applied to the streams
+static const unsigned int CMAP1_TABLE_SIZE = 256;
+
+//a cmap1 table, in the form expected by plscmap1a()
+struct Cmap1Table {
+  std::vector<PLINT> r;
+  std::vector<PLINT> g;
+  std::vector<PLINT> b;
+  std::vector<PLFLT> alpha;
 };
 
+//the interpolated palettes are shared by all plots: the caches are protected by a mutex, as plots may be rendered from several threads
+static std::mutex _colormap_cache_mutex;
+static std::map<std::pair<Gtk::PLplot::ColormapPalette, unsigned int>, std::vector<Gdk::RGBA>> _colormap_colors_cache;
+static std::map<Gtk::PLplot::ColormapPalette, Cmap1Table> _cmap1_table_cache;
+
 std::vector<double> Gtk::PLplot::indgen(unsigned int n) {
   std::vector<double> rv(n);
   for (unsigned int i = 0 ; i < n ; i++)
@@ -51,8 +64,153 @@ void Gtk::PLplot::change_plstream_color(plstream *pls, Gdk::RGBA color, bool act
     pls->col0(index);
 }
 
+//the HLS <-> RGB conversions from plctrl.c
+static double hls_value(double n1, double n2, double hue) {
+  while (hue >= 360.)
+    hue -= 360.;
+  while (hue < 0.)
+    hue += 360.;
+
+  if (hue < 60.)
+    return n1 + (n2 - n1) * hue / 60.;
+  else if (hue < 180.)
+    return n2;
+  else if (hue < 240.)
+    return n1 + (n2 - n1) * (240. - hue) / 60.;
+  return n1;
+}
+
+static void hls_to_rgb(double h, double l, double s, double &r, double &g, double &b) {
+  const double m2 = l <= .5 ? l * (s + 1.) : l + s - l * s;
+  const double m1 = 2 * l - m2;
+
+  r = hls_value(m1, m2, h + 120.);
+  g = hls_value(m1, m2, h);
+  b = hls_value(m1, m2, h - 120.);
+}
+
+static void rgb_to_hls(double r, double g, double b, double &h, double &l, double &s) {
+  const double rgb_max = std::max(r, std::max(g, b));
+  const double rgb_min = std::min(r, std::min(g, b));
+
+  l = (rgb_min + rgb_max) / 2.0;
+
+  if (rgb_min == rgb_max) {
+    s = 0;
+    h = 0;
+    return;
+  }
+
+  const double d = rgb_max - rgb_min;
+  s = l < 0.5 ? 0.5 * d / l : 0.5 * d / (1. - l);
+
+  const double rc = (rgb_max - r) / d;
+  const double gc = (rgb_max - g) / d;
+  const double bc = (rgb_max - b) / d;
+
+  if (r == rgb_max)
+    h = bc - gc;
+  else if (g == rgb_max)
+    h = rc - bc + 2.;
+  else
+    h = gc - rc - 2.0;
+
+  h = h * 60.0;
+  if (h < 0.0)
+    h = h + 360.0;
+  else if (h >= 360.0)
+    h = h - 360.0;
+}
+
+//the interpolation of plcmap1_calc(), applied to the embedded control points of the palette
+static std::vector<Gdk::RGBA> interpolate_colormap(Gtk::PLplot::ColormapPalette colormap, unsigned int n) {
+  const Gtk::PLplot::EmbeddedColormap &embedded = Gtk::PLplot::embedded_colormaps[colormap];
+
+  //PLplot stores the control points in HLS color space
+  std::vector<Gtk::PLplot::EmbeddedColormapControlPoint> points(embedded.points, embedded.points + embedded.n);
+  if (embedded.rgb) {
+    for (auto &point : points) {
+      double h, l, s;
+      rgb_to_hls(point.c1, point.c2, point.c3, h, l, s);
+      point.c1 = h;
+      point.c2 = l;
+      point.c3 = s;
+    }
+  }
+
+  std::vector<Gdk::RGBA> rv(n);
+
+  for (unsigned int j = 0 ; j < n ; j++) {
+    double delta = (double) j / (n - 1.0);
+
+    size_t i;
+    for (i = 0 ; i < points.size() - 2 ; i++) {
+      if (delta <= points[i + 1].position)
+        break;
+    }
+
+    const double dp = points[i + 1].position - points[i].position;
+    double dh = points[i + 1].c1 - points[i].c1;
+    const double dl = points[i + 1].c2 - points[i].c2;
+    const double ds = points[i + 1].c3 - points[i].c3;
+    const double da = points[i + 1].alpha - points[i].alpha;
+
+    //go around the back side of the hue circle if requested
+    if (points[i].alt_hue_path)
+      dh = dh > 0 ? dh - 360 : dh + 360;
+
+    delta = dp > 0.0 ? (delta - points[i].position) / dp : 0.0;
+
+    double h = points[i].c1 + dh * delta;
+    const double l = points[i].c2 + dl * delta;
+    const double s = points[i].c3 + ds * delta;
+    const double alpha = points[i].alpha + da * delta;
+
+    while (h >= 360.)
+      h -= 360.;
+    while (h < 0.)
+      h += 360.;
+
+    double r, g, b;
+    hls_to_rgb(h, l, s, r, g, b);
+    rv[j].set_rgba(std::min(std::max(r, 0.0), 1.0), std::min(std::max(g, 0.0), 1.0),
+                   std::min(std::max(b, 0.0), 1.0), std::min(std::max(alpha, 0.0), 1.0));
+  }
+
+  return rv;
+}
+
 void Gtk::PLplot::change_plstream_colormap(plstream *pls, Gtk::PLplot::ColormapPalette colormap) {
-  pls->spal1(_colormaps[colormap].c_str(), true);
+  std::lock_guard<std::mutex> lock(_colormap_cache_mutex);
+
+  auto it = _cmap1_table_cache.find(colormap);
+  if (it == _cmap1_table_cache.end()) {
+    Cmap1Table table;
+    for (auto &color : interpolate_colormap(colormap, CMAP1_TABLE_SIZE)) {
+      table.r.push_back(std::lround(color.get_red() * 255));
+      table.g.push_back(std::lround(color.get_green() * 255));
+      table.b.push_back(std::lround(color.get_blue() * 255));
+      table.alpha.push_back(color.get_alpha());
+    }
+    it = _cmap1_table_cache.emplace(colormap, std::move(table)).first;
+  }
+
+  const Cmap1Table &table = it->second;
+  pls->scmap1a(table.r.data(), table.g.data(), table.b.data(), table.alpha.data(), table.r.size());
+}
+
+std::vector<Gdk::RGBA> Gtk::PLplot::get_colormap_colors(Gtk::PLplot::ColormapPalette colormap, unsigned int n) {
+  if (n < 2)
+    throw Exception("Gtk::PLplot::get_colormap_colors -> n must be at least 2");
+
+  std::lock_guard<std::mutex> lock(_colormap_cache_mutex);
+
+  auto key = std::make_pair(colormap, n);
+  auto it = _colormap_colors_cache.find(key);
+  if (it == _colormap_colors_cache.end())
+    it = _colormap_colors_cache.emplace(key, interpolate_colormap(colormap, n)).first;
+
+  return it->second;
 }
 
 double **Gtk::PLplot::deep_copy_array2d(double **input, int nx, int ny) {
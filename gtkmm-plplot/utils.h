@@ -58,11 +58,24 @@ namespace Gtk {
     /** Changes the current colormap palette of the plstream
      *
      * Convenience function that allows me to change PLplot's colormap palette for PlotDataContour
+     * The palette is applied as a cached table of interpolated colors, without any file access.
      * \param pls a pointer to a plstream object
      * \param colormap the new colormap
      */
     void change_plstream_colormap(plstream *pls, ColormapPalette colormap);
 
+    /** Get the colors of a colormap palette
+     *
+     * The palette is interpolated exactly like PLplot does when it is used as its continuous colormap,
+     * allowing it to be applied to data without the help of PLplot.
+     * The palettes are embedded in the library and the interpolated colors are cached, so no file is read.
+     * \param colormap the colormap palette
+     * \param n the number of colors, at least 2
+     * \return \c n colors, evenly spread from the start to the end of the palette
+     * \exception Gtk::PLplot::Exception
+     */
+    std::vector<Gdk::RGBA> get_colormap_colors(ColormapPalette colormap, unsigned int n = 256);
+
     /** Allocates a an array of arrays
      *
      * All elements will be initialized to zero.
@@ -86,7 +99,7 @@ namespace Gtk {
 
     /** Frees a dynamically allocated array of dynamically allocated arrays.
      *
-     * Typically used to free memory allocated by deep_copy_array2d().
+     * Typically used to free memory allocated by deep_copy_array2d() or calloc_array2d().
      * \param input the array of arrays that will be recursively freed.
      * \param nx the extent along the first coordinate of input
      */
@@ -0,0 +1,111 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtkmm-plplot.h"
+#include <gtkmm/application.h>
+#include <gtkmm/aspectframe.h>
+#include <glibmm/miscutils.h>
+#include <gtkmm/window.h>
+#include <gtkmm/grid.h>
+#include <gtkmm/label.h>
+#include <gtkmm/spinbutton.h>
+#include <glib.h>
+
+#ifndef M_PI
+#define M_PI (3.14159265358979323846)
+#endif
+
+namespace Test14 {
+  // all line styles, drawn by PLplot on the left and by the Cairo fast path on the right,
+  // allowing both to be compared. Zooming in on either plot shows how the lines are clipped
+  class Window : public Gtk::Window {
+  private:
+    Gtk::PLplot::Canvas canvas;
+    Gtk::PLplot::Plot2D plot_plplot;
+    Gtk::PLplot::Plot2D plot_cairo;
+    Gtk::Grid grid;
+    Gtk::Label linewidth_label;
+    Glib::RefPtr<Gtk::Adjustment> linewidth_adj;
+    Gtk::SpinButton linewidth_spin;
+    std::vector<Gtk::PLplot::PlotData2D *> plot_data;
+
+  public:
+    Window() :
+      plot_plplot("X-axis", "Y-axis", "PLplot", 0.5, 1.0, 0.0, 0.0),
+      plot_cairo("X-axis", "Y-axis", "Fast line rendering", 0.5, 1.0, 0.5, 0.0),
+      linewidth_label("Line width"),
+      linewidth_adj(Gtk::Adjustment::create(1.0, 0.1, 10.0, 0.1, 1.0, 0.0)),
+      linewidth_spin(linewidth_adj, 0.1, 1.0) {
+
+      std::valarray<double> x_va = Gtk::PLplot::indgen_va(1000) * 4.0 * M_PI / 999.0;
+
+      for (int style = Gtk::PLplot::LineStyle::CONTINUOUS ; style <= Gtk::PLplot::LineStyle::SHORT_DASH_SHORT_GAP_MEDIUM_DASH_SHORT_GAP_LONG_DASH_SHORT_GAP ; style++) {
+        std::valarray<double> y_va = 0.3 * sin(x_va) + style;
+        for (auto plot : {&plot_plplot, &plot_cairo}) {
+          auto data = Gtk::manage(new Gtk::PLplot::PlotData2D(x_va, y_va, Gdk::RGBA("blue"), static_cast<Gtk::PLplot::LineStyle>(style)));
+          data->set_fast_line_rendering(plot == &plot_cairo);
+          plot->add_data(*data);
+          plot_data.push_back(data);
+        }
+      }
+
+      plot_plplot.hide_legend();
+      plot_cairo.hide_legend();
+      canvas.add_plot(plot_plplot);
+      canvas.add_plot(plot_cairo);
+
+      const int width = 1024, height = 580;
+      set_default_size(width, height);
+      set_title("Gtkmm-PLplot test14");
+      canvas.set_hexpand(true);
+      canvas.set_vexpand(true);
+      canvas.set_focusable(true);
+      Gtk::AspectFrame geometry(Gtk::Align::CENTER, Gtk::Align::CENTER, float(width)/float(height), false);
+      geometry.set_child(canvas);
+
+      linewidth_spin.set_numeric(true);
+      linewidth_spin.set_value(1.0);
+      linewidth_spin.signal_value_changed().connect([this](){
+        for (auto data : plot_data)
+          data->set_line_width(linewidth_spin.get_value());
+      });
+
+      linewidth_label.set_halign(Gtk::Align::END);
+      linewidth_label.set_hexpand(true);
+      linewidth_spin.set_halign(Gtk::Align::START);
+      linewidth_spin.set_hexpand(true);
+
+      grid.attach(linewidth_label, 0, 0, 1, 1);
+      grid.attach(linewidth_spin, 1, 0, 1, 1);
+      grid.attach(geometry, 0, 1, 2, 1);
+      grid.set_row_spacing(5);
+      grid.set_column_spacing(5);
+      grid.set_column_homogeneous(false);
+
+      grid.set_margin(10);
+      set_child(grid);
+    }
+    virtual ~Window() {}
+  };
+}
+
+int main(int argc, char *argv[]) {
+  Glib::set_application_name("gtkmm-plplot-test14");
+  Glib::RefPtr<Gtk::Application> app = Gtk::Application::create("eu.tomschoonjans.gtkmm-plplot-test14");
+
+  return app->make_window_and_run<Test14::Window>(argc, argv);
+}
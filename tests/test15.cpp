@@ -0,0 +1,170 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtkmm-plplot.h"
+#include <gtkmm/application.h>
+#include <glibmm/miscutils.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <algorithm>
+
+// Measures how the rendering time of a PlotContourShades plot is divided between
+// the PLplot work, which always happens on the main thread, and the rasterization by Cairo,
+// which Canvas can move to a background thread with set_async_rasterization(),
+// or divide over a pool of threads with set_parallel_rasterization().
+// No window is shown: the plots are rendered with a Renderer.
+
+namespace Test15 {
+  const int width = 1024, height = 720;
+  const int iterations = 10;
+
+  typedef std::chrono::steady_clock Clock;
+
+  double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  }
+
+  Gtk::PLplot::PlotContourShades *create_plot(unsigned int n, unsigned int nlevels,
+                                              double plot_width_norm = 1.0, double plot_height_norm = 1.0,
+                                              double plot_offset_horizontal_norm = 0.0, double plot_offset_vertical_norm = 0.0) {
+    std::vector<double> x(Gtk::PLplot::indgen(n)), y(Gtk::PLplot::indgen(n)), z(n * n);
+    for (unsigned int i = 0 ; i < n ; i++)
+      for (unsigned int j = 0 ; j < n ; j++)
+        z[i * n + j] = sin(i * 12.0 / n) * cos(j * 9.0 / n) + 0.3 * sin((i + j) * 30.0 / n);
+
+    return Gtk::manage(new Gtk::PLplot::PlotContourShades(
+      *Gtk::manage(new Gtk::PLplot::PlotDataSurface(x, y, z.data())),
+      "X-axis", "Y-axis", "", nlevels, Gtk::PLplot::BLUE_YELLOW, Gdk::RGBA("black"), 1.0,
+      plot_width_norm, plot_height_norm, plot_offset_horizontal_norm, plot_offset_vertical_norm));
+  }
+
+  void measure(Gtk::PLplot::Renderer &renderer, const Glib::ustring &description) {
+    auto image = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, width, height);
+    double synchronous = 0.0, recording = 0.0, rasterization = 0.0;
+
+    for (int i = 0 ; i < iterations ; i++) {
+      // what Canvas does on the main thread by default
+      auto start = Clock::now();
+      renderer.render(image, width, height);
+      image->flush();
+      synchronous += elapsed_ms(start);
+
+      // the part that remains on the main thread with asynchronous rasterization
+      start = Clock::now();
+      auto recorded = Cairo::RecordingSurface::create();
+      renderer.render(recorded, width, height);
+      recorded->flush();
+      recording += elapsed_ms(start);
+
+      // the part that is moved to the background thread
+      start = Clock::now();
+      auto cr = Cairo::Context::create(image);
+      cr->set_source(recorded, 0.0, 0.0);
+      cr->paint();
+      image->flush();
+      rasterization += elapsed_ms(start);
+    }
+
+    std::cout << std::fixed << std::setprecision(1) << description << std::endl;
+    std::cout << "  synchronous rendering:               " << synchronous / iterations << " ms" << std::endl;
+    std::cout << "  PLplot and recording (main thread):  " << recording / iterations << " ms" << std::endl;
+    std::cout << "  rasterization (background thread):   " << rasterization / iterations << " ms" << std::endl;
+  }
+
+  // the steps Canvas goes through in parallel rasterization mode, for a grid of plots that all changed
+  void measure_grid(Gtk::PLplot::Renderer &renderer, const std::vector<Gtk::PLplot::Plot *> &plots, const Glib::ustring &description) {
+    auto image = Cairo::ImageSurface::create(Cairo::Surface::Format::ARGB32, width, height);
+    auto cr = Cairo::Context::create(image);
+    const unsigned int n_threads = std::max(1u, std::thread::hardware_concurrency());
+    double synchronous = 0.0, recording = 0.0, serial_rasterization = 0.0, parallel_rasterization = 0.0;
+
+    for (int i = 0 ; i < iterations ; i++) {
+      auto start = Clock::now();
+      renderer.render(image, width, height);
+      image->flush();
+      synchronous += elapsed_ms(start);
+
+      // PLplot is not thread-safe: the plots are always recorded one after the other on the main thread
+      std::vector<Cairo::RefPtr<Cairo::RecordingSurface>> recordings;
+      start = Clock::now();
+      for (auto plot : plots) {
+        plot->invalidate_plot_cache();
+        recordings.push_back(plot->record_plot_cached(cr, width, height));
+      }
+      recording += elapsed_ms(start);
+
+      start = Clock::now();
+      for (unsigned int j = 0 ; j < plots.size() ; j++)
+        plots[j]->rasterize_plot_cache(recordings[j]);
+      serial_rasterization += elapsed_ms(start);
+
+      recordings.clear();
+      for (auto plot : plots) {
+        plot->invalidate_plot_cache();
+        recordings.push_back(plot->record_plot_cached(cr, width, height));
+      }
+
+      start = Clock::now();
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0 ; t < n_threads ; t++)
+        threads.emplace_back([&plots, &recordings, t, n_threads]() {
+          for (unsigned int j = t ; j < plots.size() ; j += n_threads)
+            plots[j]->rasterize_plot_cache(recordings[j]);
+        });
+      for (auto &thread : threads)
+        thread.join();
+      parallel_rasterization += elapsed_ms(start);
+    }
+
+    std::cout << std::fixed << std::setprecision(1) << description << std::endl;
+    std::cout << "  synchronous rendering:               " << synchronous / iterations << " ms" << std::endl;
+    std::cout << "  PLplot and recording (main thread):  " << recording / iterations << " ms" << std::endl;
+    std::cout << "  rasterization (1 thread):            " << serial_rasterization / iterations << " ms" << std::endl;
+    std::cout << "  rasterization (" << std::setw(2) << n_threads << " threads):          " << parallel_rasterization / iterations << " ms" << std::endl;
+  }
+
+  void run() {
+    for (unsigned int nlevels : {10, 50}) {
+      Gtk::PLplot::Renderer renderer(*create_plot(200, nlevels));
+      measure(renderer, Glib::ustring::compose("200x200 surface, %1 shade levels", nlevels));
+    }
+
+    for (unsigned int nlevels : {10, 50}) {
+      Gtk::PLplot::Renderer renderer;
+      std::vector<Gtk::PLplot::Plot *> plots;
+      for (unsigned int i = 0 ; i < 4 ; i++) {
+        for (unsigned int j = 0 ; j < 4 ; j++) {
+          plots.push_back(create_plot(100, nlevels, 0.25, 0.25, 0.25 * i, 0.25 * j));
+          renderer.add_plot(*plots.back());
+        }
+      }
+      measure_grid(renderer, plots, Glib::ustring::compose("4x4 grid of 100x100 surfaces, %1 shade levels", nlevels));
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  Glib::set_application_name("gtkmm-plplot-test15");
+  Glib::RefPtr<Gtk::Application> app = Gtk::Application::create("eu.tomschoonjans.gtkmm-plplot-test15");
+
+  app->signal_activate().connect(&Test15::run);
+
+  return app->run(argc, argv);
+}
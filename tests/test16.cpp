@@ -0,0 +1,176 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtkmm-plplot.h"
+#include <gtkmm/application.h>
+#include <gtkmm/aspectframe.h>
+#include <glibmm/miscutils.h>
+#include <glibmm/main.h>
+#include <gtkmm/window.h>
+#include <gtkmm/grid.h>
+#include <gtkmm/switch.h>
+#include <gtkmm/label.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#ifndef M_PI
+#define M_PI (3.14159265358979323846)
+#endif
+
+// Several producer threads push blocks of datapoints concurrently into a single PlotData2DQueue,
+// which is drained into a PlotData2DRingBuffer once per frame of the canvas.
+// Producer i generates Y-values between i and i + 1: since blocks are queued as a whole,
+// every run of datapoints from the same producer in the dataset must consist of complete blocks.
+// This is checked twice per second. While the producers are paused, the queue stops listening to the frame clock.
+
+namespace Test16 {
+  const unsigned int n_producers = 4;
+  const size_t block_size = 16;
+  const std::chrono::microseconds block_interval(5000);
+
+  class Window : public Gtk::Window {
+  private:
+    Gtk::PLplot::Canvas canvas;
+    Gtk::PLplot::PlotData2DRingBuffer *plot_data;
+    Gtk::PLplot::PlotData2DQueue queue;
+    Gtk::Grid grid;
+    Gtk::Label producers_label;
+    Gtk::Switch producers_switch;
+    Gtk::Label status_label;
+    std::vector<std::thread> producers;
+    std::atomic<bool> paused;
+    std::atomic<bool> quit;
+    std::atomic<unsigned long> pushed;
+    std::atomic<unsigned long> rejected;
+    unsigned long interleaved = 0;
+    std::chrono::steady_clock::time_point start;
+
+    void produce(unsigned int id) {
+      std::vector<double> x(block_size), y(block_size);
+      auto next = std::chrono::steady_clock::now();
+
+      while (!quit.load()) {
+        next += block_interval;
+        std::this_thread::sleep_until(next);
+        if (paused.load())
+          continue;
+
+        const double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        for (size_t i = 0 ; i < block_size ; i++) {
+          x[i] = t + i * 1E-6;
+          y[i] = id + 0.5 + 0.4 * std::sin(M_PI * (id + 1) * x[i]);
+        }
+
+        if (queue.push(x.data(), y.data(), block_size))
+          pushed += block_size;
+        else
+          rejected += block_size;
+      }
+    }
+
+    bool check_blocks() {
+      //the first run may have been partially evicted from the ring buffer
+      const std::vector<double> y = plot_data->get_vector_y();
+      size_t run_start = 0;
+      bool first_run = true;
+      for (size_t i = 1 ; i <= y.size() ; i++) {
+        if (i < y.size() && std::floor(y[i]) == std::floor(y[run_start]))
+          continue;
+        if (!first_run && (i - run_start) % block_size != 0)
+          interleaved++;
+        first_run = false;
+        run_start = i;
+      }
+
+      if (interleaved > 0)
+        std::cerr << "Test16: found " << interleaved << " interleaved blocks" << std::endl;
+
+      status_label.set_text(Glib::ustring::compose("pushed: %1   rejected (queue full): %2   interleaved blocks: %3",
+        pushed.load(), rejected.load(), interleaved));
+
+      return true;
+    }
+  public:
+    Window() :
+      canvas(),
+      plot_data(Gtk::manage(new Gtk::PLplot::PlotData2DRingBuffer(50000, Gdk::RGBA("Blue"), Gtk::PLplot::LineStyle::NONE))),
+      queue(*plot_data, 4096, true),
+      producers_label("Producers"),
+      paused(false), quit(false), pushed(0), rejected(0),
+      start(std::chrono::steady_clock::now()) {
+
+      // general window and canvas settings
+      const int width = 1024, height = 580;
+      set_default_size(width, height);
+      set_title("Gtkmm-PLplot test16");
+      canvas.set_hexpand(true);
+      canvas.set_vexpand(true);
+      Gtk::AspectFrame geometry(Gtk::Align::CENTER, Gtk::Align::CENTER, float(width)/float(height), false);
+      geometry.set_child(canvas);
+
+      plot_data->set_symbol(".");
+      plot_data->set_symbol_color(Gdk::RGBA("Blue"));
+      plot_data->set_symbol_sprites(true);
+
+      Gtk::PLplot::Plot2D *plot = Gtk::manage(new Gtk::PLplot::Plot2D(*plot_data, "Time (s)", "Producer", "Concurrent producers"));
+      canvas.add_plot(*plot);
+
+      queue.attach(canvas);
+
+      producers_switch.set_active(true);
+      producers_switch.property_active().signal_changed().connect([this](){
+        paused = !producers_switch.get_active();
+      });
+      producers_label.set_halign(Gtk::Align::END);
+      producers_switch.set_halign(Gtk::Align::START);
+      producers_switch.set_hexpand(true);
+      status_label.set_hexpand(true);
+
+      grid.set_column_spacing(5);
+      grid.set_row_spacing(5);
+      grid.attach(geometry, 0, 0, 2, 1);
+      grid.attach(producers_label, 0, 1, 1, 1);
+      grid.attach(producers_switch, 1, 1, 1, 1);
+      grid.attach(status_label, 0, 2, 2, 1);
+      grid.set_margin(10);
+      set_child(grid);
+
+      for (unsigned int id = 0 ; id < n_producers ; id++)
+        producers.emplace_back(&Window::produce, this, id);
+
+      Glib::signal_timeout().connect(sigc::mem_fun(*this, &Window::check_blocks), 500);
+    }
+
+    virtual ~Window() {
+      //the producers must stop before the queue is destroyed
+      quit = true;
+      for (auto &producer : producers)
+        producer.join();
+    }
+  };
+}
+
+int main(int argc, char *argv[]) {
+  Glib::set_application_name("gtkmm-plplot-test16");
+  Glib::RefPtr<Gtk::Application> app = Gtk::Application::create("eu.tomschoonjans.gtkmm-plplot-test16");
+
+  return app->make_window_and_run<Test16::Window>(argc, argv);
+}
@@ -0,0 +1,195 @@
+/*
+Copyright (C) 2026 Tom Schoonjans
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtkmm-plplot.h"
+#include <gtkmm-plplot/decimation.h>
+#include <glibmm/init.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// Checks the index arithmetic behind culling, decimation and the ring buffer caches of PlotData2D.
+// This program does not open a window: it exits with a non-zero status at the first failed check.
+
+namespace Test17 {
+  void check(bool condition, const char *message) {
+    if (condition)
+      return;
+    std::cerr << "Test17: " << message << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // exposes the binary search used for culling the datapoints outside of the plotted window
+  template <class T>
+  class CullingData : public T {
+  public:
+    using T::T;
+
+    void get_visible_range(double xmin, double xmax, size_t &lo, size_t &hi) {
+      double world_range_x[2] = {xmin, xmax};
+      double world_range_y[2] = {-1.0, 1.0};
+      Gtk::PLplot::PlotData2DAuxData aux_data(world_range_x, world_range_y, false, false, 500.0, 300.0);
+      this->draw_aux_data = &aux_data;
+      const bool sorted = T::get_visible_range(0, this->size(), lo, hi);
+      this->draw_aux_data = nullptr;
+      check(sorted, "sorted X-values were reported as unsorted");
+    }
+  };
+
+  void check_envelope() {
+    const size_t n = 20000, columns = 50;
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    // the datapoints extend beyond the plotted window on either side
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0 ; i < n ; i++) {
+      x[i] = -10.0 + 120.0 * i / (n - 1);
+      y[i] = distribution(generator);
+    }
+
+    double world_range_x[2] = {0.0, 100.0};
+    double world_range_y[2] = {-1.0, 1.0};
+    Gtk::PLplot::PlotData2DAuxData aux_data(world_range_x, world_range_y, false, false, columns, 300.0);
+    std::vector<double> x_dec, y_dec;
+    Gtk::PLplot::decimate_min_max_envelope(x.data(), y.data(), n, aux_data, columns, x_dec, y_dec);
+
+    check(x_dec.size() == y_dec.size(), "envelope: X- and Y-values differ in size");
+    check(x_dec.size() <= 4 * (columns + 2), "envelope: more than four datapoints per column were kept");
+    check(x_dec.front() == x.front() && x_dec.back() == x.back(), "envelope: the endpoints were not kept");
+    check(std::is_sorted(x_dec.begin(), x_dec.end()), "envelope: the order of the datapoints was not preserved");
+
+    // the outside datapoints end up in columns -1 and columns
+    auto get_column = [&](double xval) -> long {
+      return std::min(std::max(static_cast<long>(std::floor(xval * columns / 100.0)), -1L), static_cast<long>(columns));
+    };
+
+    for (long column = -1 ; column <= static_cast<long>(columns) ; column++) {
+      double ymin = INFINITY, ymax = -INFINITY, ymin_dec = INFINITY, ymax_dec = -INFINITY;
+      for (size_t i = 0 ; i < n ; i++) {
+        if (get_column(x[i]) == column) {
+          ymin = std::min(ymin, y[i]);
+          ymax = std::max(ymax, y[i]);
+        }
+      }
+      for (size_t i = 0 ; i < x_dec.size() ; i++) {
+        if (get_column(x_dec[i]) == column) {
+          ymin_dec = std::min(ymin_dec, y_dec[i]);
+          ymax_dec = std::max(ymax_dec, y_dec[i]);
+        }
+      }
+      check(ymin == ymin_dec && ymax == ymax_dec, "envelope: the minimum or maximum of a column was lost");
+    }
+  }
+
+  void check_lttb() {
+    const size_t n = 10000;
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0 ; i < n ; i++) {
+      x[i] = i * 0.01;
+      y[i] = std::sin(x[i]) + 0.1 * std::sin(37.0 * x[i]);
+    }
+
+    double world_range_x[2] = {x.front(), x.back()};
+    double world_range_y[2] = {-1.1, 1.1};
+    Gtk::PLplot::PlotData2DAuxData aux_data(world_range_x, world_range_y, false, false, 500.0, 300.0);
+
+    const std::vector<size_t> thresholds = {3, 4, 100, 1000, n - 1};
+    for (size_t threshold : thresholds) {
+      std::vector<double> x_dec, y_dec;
+      Gtk::PLplot::decimate_lttb(x.data(), y.data(), n, aux_data, threshold, x_dec, y_dec);
+
+      check(x_dec.size() == y_dec.size(), "LTTB: X- and Y-values differ in size");
+      check(x_dec.size() <= threshold, "LTTB: more datapoints than the threshold were kept");
+      check(x_dec.front() == x.front() && y_dec.front() == y.front(), "LTTB: the first datapoint was not kept");
+      check(x_dec.back() == x.back() && y_dec.back() == y.back(), "LTTB: the last datapoint was not kept");
+      check(std::adjacent_find(x_dec.begin(), x_dec.end(), std::greater_equal<double>()) == x_dec.end(), "LTTB: a datapoint was kept twice or out of order");
+      for (size_t i = 0 ; i < x_dec.size() ; i++) {
+        const size_t index = std::lround(x_dec[i] / 0.01);
+        check(index < n && x[index] == x_dec[i] && y[index] == y_dec[i], "LTTB: a datapoint was kept that is not part of the dataset");
+      }
+    }
+  }
+
+  void check_culling() {
+    const size_t n = 1000;
+    std::vector<double> x(n), y(n, 0.0);
+    for (size_t i = 0 ; i < n ; i++)
+      x[i] = i;
+    CullingData<Gtk::PLplot::PlotData2D> data(x, y);
+    size_t lo, hi;
+
+    // one datapoint on either side of the window is included
+    data.get_visible_range(100.5, 200.5, lo, hi);
+    check(lo == 100 && hi == 202, "culling: wrong slice for a window between datapoints");
+    data.get_visible_range(100.0, 200.0, lo, hi);
+    check(lo == 99 && hi == 202, "culling: wrong slice for a window on datapoints");
+    data.get_visible_range(200.0, 100.0, lo, hi);
+    check(lo == 99 && hi == 202, "culling: wrong slice for a reversed window");
+    data.get_visible_range(0.0, n - 1.0, lo, hi);
+    check(lo == 0 && hi == n, "culling: wrong slice for a window on the first and last datapoints");
+    data.get_visible_range(-5.0, 2.0 * n, lo, hi);
+    check(lo == 0 && hi == n, "culling: wrong slice for a window wider than the dataset");
+    data.get_visible_range(-10.0, -5.0, lo, hi);
+    check(lo == 0 && hi == 1, "culling: wrong slice for a window before the dataset");
+    data.get_visible_range(2.0 * n, 3.0 * n, lo, hi);
+    check(lo == n - 1 && hi == n, "culling: wrong slice for a window after the dataset");
+  }
+
+  void check_ring_buffer() {
+    const size_t capacity = 100;
+    CullingData<Gtk::PLplot::PlotData2DRingBuffer> data(capacity);
+    std::mt19937 generator(17);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    // the extremes are evicted regularly, forcing them to be recalculated
+    for (size_t i = 0 ; i < 10 * capacity + 37 ; i++) {
+      data.add_datapoint(static_cast<double>(i), i % 150 == 0 ? 10.0 : distribution(generator));
+
+      const std::vector<double> x = data.get_vector_x();
+      const std::vector<double> y = data.get_vector_y();
+      check(x.size() == std::min(i + 1, capacity), "ring buffer: wrong size");
+      check(x.back() == i, "ring buffer: the most recent datapoint is missing");
+
+      double xmin, xmax, ymin, ymax;
+      data.get_extremes(xmin, xmax, ymin, ymax);
+      check(xmin == *std::min_element(x.begin(), x.end()) && xmax == *std::max_element(x.begin(), x.end()), "ring buffer: wrong X extremes");
+      check(ymin == *std::min_element(y.begin(), y.end()) && ymax == *std::max_element(y.begin(), y.end()), "ring buffer: wrong Y extremes");
+    }
+
+    // culling addresses the datapoints relative to the oldest one
+    size_t lo, hi;
+    const double oldest = data.get_vector_x().front();
+    data.get_visible_range(oldest + 10.5, oldest + 20.5, lo, hi);
+    check(lo == 10 && hi == 22, "ring buffer: wrong slice after wraparound");
+  }
+}
+
+int main() {
+  Glib::init();
+
+  Test17::check_envelope();
+  Test17::check_lttb();
+  Test17::check_culling();
+  Test17::check_ring_buffer();
+
+  std::cout << "Test17: all checks passed" << std::endl;
+  return EXIT_SUCCESS;
+}